@@ -0,0 +1,155 @@
+#include "base.h"
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "status.h"
+#include "uart.h"
+#include "util.h"
+
+#define BASE_TOLERANCE_MM_DEFAULT 5000  // a single point fix is good to a few meters
+#define BASE_FIX_POLL_MS          1000
+#define BASE_FIX_POLLS            120  // a cold start takes well under 2 min, then a new survey is safer
+#define BASE_COORD_LEN            32
+
+// WGS84 ellipsoid
+#define WGS84_A  6378137.0
+#define WGS84_F  (1 / 298.257223563)
+#define WGS84_E2 (WGS84_F * (2 - WGS84_F))
+
+#define DEG2RAD(deg) ((deg) * M_PI / 180)
+#define RAD2DEG(rad) ((rad) * 180 / M_PI)
+
+static const char* TAG = "BASE";
+
+// ECEF in 0.1 mm to latitude and longitude in deg, height above the ellipsoid in m
+static void base_ecef_to_llh(int64_t x_e4, int64_t y_e4, int64_t z_e4, double* lat, double* lon, double* alt)
+{
+    double x = x_e4 / 1e4;
+    double y = y_e4 / 1e4;
+    double z = z_e4 / 1e4;
+    double p = sqrt(x * x + y * y);
+    double phi = atan2(z, p * (1 - WGS84_E2));
+    double n;
+
+    // converges to well below 0.1 mm in a few rounds anywhere near the surface
+    for (int i = 0; i < 5; i++)
+    {
+        n = WGS84_A / sqrt(1 - WGS84_E2 * sin(phi) * sin(phi));
+        phi = atan2(z + WGS84_E2 * n * sin(phi), p);
+    }
+    n = WGS84_A / sqrt(1 - WGS84_E2 * sin(phi) * sin(phi));
+
+    *lat = RAD2DEG(phi);
+    *lon = RAD2DEG(atan2(y, x));
+    *alt = p * cos(phi) + z * sin(phi) - WGS84_A * WGS84_A / n;
+}
+
+// local north, east and up offsets of the fix, plenty for a tolerance of meters
+static double base_distance_mm(const status_gnss_t* gnss, double lat, double lon, double alt)
+{
+    double north = DEG2RAD(gnss->lat / 1e9 - lat) * WGS84_A;
+    double east = DEG2RAD(gnss->lon / 1e9 - lon) * WGS84_A * cos(DEG2RAD(lat));
+    double up = (gnss->hmsl + gnss->geoid_sep) / 1e4 - alt;
+    return sqrt(north * north + east * east + up * up) * 1000;
+}
+
+static void base_survey_event_handler(void* event_handler_arg, esp_event_base_t event_base, int32_t event_id, void* event_data)
+{
+    status_gnss_t gnss;
+    char text[CONFIG_LEN_MAX];
+    double lat, lon, alt;
+
+    status_gnss_get(&gnss);
+    base_ecef_to_llh(gnss.svin_x, gnss.svin_y, gnss.svin_z, &lat, &lon, &alt);
+
+    // in the format of the fixed mode form, so it goes to ubx_set_mode_fixed unchanged
+    snprintf(text, sizeof(text), "%.9f,%.9f,%.4f", lat, lon, alt);
+    config_set(CONFIG_BASE_SURVEY, text);
+    ESP_LOGI(TAG, "Surveyed position saved: %s, accuracy %lu.%lu mm", text, gnss.svin_acc / 10, gnss.svin_acc % 10);
+}
+
+static void base_restore_task(void* ctx)
+{
+    char lat[BASE_COORD_LEN];
+    char lon[BASE_COORD_LEN];
+    char alt[BASE_COORD_LEN];
+    status_gnss_t gnss;
+    double distance = -1;
+
+    uint32_t tolerance = BASE_TOLERANCE_MM_DEFAULT;
+    char* value = config_get(CONFIG_BASE_TOLERANCE_MM);
+    if (strlen(value) > 0 && atoi(value) > 0)
+    {
+        tolerance = atoi(value);
+    }
+
+    if (sscanf(config_get(CONFIG_BASE_SURVEY), "%31[^,],%31[^,],%31s", lat, lon, alt) != 3)
+    {
+        ERROR("Invalid surveyed position: %s", config_get(CONFIG_BASE_SURVEY));
+        base_forget();
+        vTaskDelete(NULL);
+        return;
+    }
+
+    // the antenna may have moved while powered off, only a fix as good as the tolerance can tell
+    for (int i = 0; i < BASE_FIX_POLLS && distance < 0; i++)
+    {
+        vTaskDelay(pdMS_TO_TICKS(BASE_FIX_POLL_MS));
+        status_gnss_get(&gnss);
+        if (gnss.quality > 0 && gnss.sigma_lat <= tolerance && gnss.sigma_alt <= tolerance)
+        {
+            distance = base_distance_mm(&gnss, atof(lat), atof(lon), atof(alt));
+        }
+    }
+
+    if (distance >= 0 && distance <= tolerance)
+    {
+        ESP_LOGI(TAG, "Fix is %.0f mm from the surveyed position, restarting in fixed mode", distance);
+        ubx_set_mode_fixed(lat, lon, alt);
+    }
+    else
+    {
+        // keep the old result until the new survey replaces it, a later boot may still match it
+        if (distance < 0)
+        {
+            ESP_LOGW(TAG, "No fix within %lu mm to check the surveyed position, surveying again", tolerance);
+        }
+        else
+        {
+            ESP_LOGW(TAG, "Fix is %.0f mm from the surveyed position, surveying again", distance);
+        }
+        ubx_set_mode_survey("", "");
+    }
+
+    vTaskDelete(NULL);
+}
+
+esp_err_t base_init()
+{
+    // a completed survey is saved for the next boot
+    uart_register_handler(UART_STATUS_EVENT_SURVEY, base_survey_event_handler);
+
+    if (strlen(config_get(CONFIG_BASE_SURVEY)) > 0)
+    {
+        BaseType_t ret = xTaskCreate(base_restore_task, "base_restore", 4096, NULL, 5, NULL);
+        ERROR_IF(ret != pdPASS, return ESP_ERR_NO_MEM, "Cannot start base restore task");
+    }
+
+    return ESP_OK;
+}
+
+// the operator chose another mode, the base must not come back surveyed after a restart
+void base_forget()
+{
+    if (strlen(config_get(CONFIG_BASE_SURVEY)) > 0)
+    {
+        config_set(CONFIG_BASE_SURVEY, "");
+    }
+}
@@ -0,0 +1,9 @@
+#ifndef ESP32S3_GNSS_BASE_H
+#define ESP32S3_GNSS_BASE_H
+
+#include <esp_err.h>
+
+esp_err_t base_init();
+void base_forget();
+
+#endif  // ESP32S3_GNSS_BASE_H
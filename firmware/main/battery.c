@@ -57,8 +57,6 @@ esp_err_t battery_init()
     ESP_ERROR_CHECK(adc_oneshot_new_unit(&unit_config, &bat_vol_adc_handle));
     ESP_ERROR_CHECK(adc_oneshot_config_channel(bat_vol_adc_handle, BAT_VOL_ADC_CHAN, &chan_config));
 
-    vTaskDelay(pdMS_TO_TICKS(1000));
-
     xTaskCreate(battery_task, "battery_task", 2048, NULL, 10, NULL);
     return ESP_OK;
 }
@@ -0,0 +1,126 @@
+#include "boot.h"
+
+#include <esp_timer.h>
+#include <freertos/task.h>
+#include <stdio.h>
+
+#include "util.h"
+
+#define BOOT_TASK_STACK    4096
+#define BOOT_TASK_PRIORITY 10
+
+static const char* TAG = "BOOT";
+
+static const char* BOOT_NAME[BOOT_MAX] = {
+    "config",       //
+    "wifi",         //
+    "web_app",      //
+    "uart",         //
+    "ubx_ready",    //
+    "ubx_config",   //
+    "rtcm3_baud",   //
+    "battery",      //
+    "caster",       //
+    "base",         //
+    "sdlog",        //
+    "ip",           //
+    "first_rtcm3",  //
+};
+
+// every phase is written by the one task that runs it, then only read, 0 means not reached yet
+static struct
+{
+    int64_t begin_us;  // since power on
+    int64_t end_us;
+    esp_err_t err;
+} phases[BOOT_MAX];
+
+// a bit per ended phase, steps wait on the bits of their dependencies
+static EventGroupHandle_t boot_group = NULL;
+
+esp_err_t boot_init()
+{
+    boot_group = xEventGroupCreate();
+    ERROR_IF(boot_group == NULL, return ESP_ERR_NO_MEM, "Cannot create boot event group");
+    return ESP_OK;
+}
+
+void boot_begin(boot_phase_t phase)
+{
+    phases[phase].begin_us = esp_timer_get_time();
+}
+
+void boot_end(boot_phase_t phase)
+{
+    phases[phase].end_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "%s: %lld us, done at %lld us", BOOT_NAME[phase], phases[phase].end_us - phases[phase].begin_us, phases[phase].end_us);
+    xEventGroupSetBits(boot_group, BOOT_BIT(phase));
+}
+
+void boot_mark(boot_phase_t phase)
+{
+    // a milestone, not a phase, so it is timed from power on
+    phases[phase].begin_us = 0;
+    phases[phase].end_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "%s at %lld us", BOOT_NAME[phase], phases[phase].end_us);
+    xEventGroupSetBits(boot_group, BOOT_BIT(phase));
+}
+
+static void boot_task(void* ctx)
+{
+    const boot_step_t* step = ctx;
+
+    if (step->after != 0)
+    {
+        xEventGroupWaitBits(boot_group, step->after, pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+
+    // a failed phase still ends, as in the serial startup its dependents go on without it
+    boot_begin(step->phase);
+    phases[step->phase].err = step->init();
+    ERROR_IF(phases[step->phase].err != ESP_OK, , "Cannot start %s: %s", BOOT_NAME[step->phase], esp_err_to_name(phases[step->phase].err));
+    boot_end(step->phase);
+
+    vTaskDelete(NULL);
+}
+
+esp_err_t boot_start(const boot_step_t* step)
+{
+    BaseType_t ret = xTaskCreate(boot_task, BOOT_NAME[step->phase], BOOT_TASK_STACK, (void*)step, BOOT_TASK_PRIORITY, NULL);
+    ERROR_IF(ret != pdPASS, return ESP_ERR_NO_MEM, "Cannot start boot task %s", BOOT_NAME[step->phase]);
+    return ESP_OK;
+}
+
+void boot_wait(EventBits_t bits)
+{
+    xEventGroupWaitBits(boot_group, bits, pdFALSE, pdTRUE, portMAX_DELAY);
+}
+
+size_t boot_print(char* buffer, size_t len)
+{
+    size_t pos = 0;
+    int n;
+
+    // one line per phase, in us since power on
+    for (size_t phase = BOOT_START; phase < BOOT_MAX && pos < len - 1; phase++)
+    {
+        int64_t end_us = phases[phase].end_us;
+        int64_t begin_us = phases[phase].begin_us;
+        n = snprintf(buffer + pos,
+                     len - pos,
+                     "%s=begin_us:%lld,end_us:%lld,us:%lld,err:%s" NEWLINE,
+                     BOOT_NAME[phase],
+                     begin_us,
+                     end_us,
+                     end_us > begin_us ? end_us - begin_us : 0,
+                     esp_err_to_name(phases[phase].err));
+        if (n < 0 || (size_t)n >= len - pos)
+        {
+            break;
+        }
+        pos += n;
+    }
+
+    buffer[pos] = '\0';
+    return pos;
+}
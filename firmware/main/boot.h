@@ -0,0 +1,47 @@
+#ifndef ESP32S3_GNSS_BOOT_H
+#define ESP32S3_GNSS_BOOT_H
+
+#include <esp_err.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <stddef.h>
+
+// startup phases, each one is timed on every boot from its begin to its end
+typedef enum
+{
+    BOOT_START = 0,
+    BOOT_CONFIG = BOOT_START,  // NVS, settings, status and shared buffers, before anything runs in parallel
+    BOOT_WIFI,                 // AP+STA interfaces started
+    BOOT_WEB_APP,              // SPIFFS mounted and web server listening
+    BOOT_UART,                 // both ports up, until the RTCM3 reader starts
+    BOOT_UBX_READY,            // receiver answered its first poll
+    BOOT_UBX_CONFIG,           // default configuration acknowledged
+    BOOT_RTCM3_BAUD,           // UART2 rate negotiated
+    BOOT_BATTERY,              // ADC ready
+    BOOT_CASTER,               // NTRIP caster listening
+    BOOT_BASE,                 // surveyed position checked, restored in the background
+    BOOT_SDLOG,                // SD card mounted and log buffers ready
+    BOOT_IP,                   // station got an IP address
+    BOOT_FIRST_RTCM3,          // first valid frame read from UART2, the startup target
+    BOOT_MAX
+} boot_phase_t;
+
+#define BOOT_BIT(phase) ((EventBits_t)1 << (phase))
+
+// one subsystem started by boot_start, after every phase in its dependencies ended
+typedef struct
+{
+    boot_phase_t phase;
+    esp_err_t (*init)();
+    EventBits_t after;  // BOOT_BIT of each phase it needs
+} boot_step_t;
+
+esp_err_t boot_init();
+void boot_begin(boot_phase_t phase);
+void boot_end(boot_phase_t phase);
+void boot_mark(boot_phase_t phase);
+esp_err_t boot_start(const boot_step_t* step);
+void boot_wait(EventBits_t bits);
+size_t boot_print(char* buffer, size_t len);
+
+#endif  // ESP32S3_GNSS_BOOT_H
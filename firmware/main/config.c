@@ -17,18 +17,28 @@ static nvs_handle_t nvs = 0;
 // ordered status list
 static char config[CONFIG_MAX][CONFIG_LEN_MAX];
 static char config_name[CONFIG_MAX][CONFIG_LEN_MAX / 2] = {
-    "hostname",    //
-    "version",     //
-    "wifi_ssid",   //
-    "wifi_pwd",    //
-    "ntrip_ip",    //
-    "ntrip_port",  //
-    "ntrip_user",  //
-    "ntrip_pwd",   //
-    "ntrip_mnt",   //
-    "base_lat",    //
-    "base_lon",    //
-    "base_alt",    //
+    "hostname",         //
+    "version",          //
+    "wifi_ssid",        //
+    "wifi_pwd",         //
+    "ntrip_ip",         //
+    "ntrip_port",       //
+    "ntrip_user",       //
+    "ntrip_pwd",        //
+    "ntrip_mnt",        //
+    "base_lat",         //
+    "base_lon",         //
+    "base_alt",         //
+    "caster_hold_ms",   //
+    "rtcm3_baud",       //
+    "caster_alive_ms",  //
+    "rtcm3_profile",    //
+    "uplink_bytes_s",   //
+    "base_survey",      //
+    "base_tol_mm",      //
+    "log_rotate_kb",    //
+    "log_rotate_s",     //
+    "log_sync_ms",      //
 };
 
 esp_err_t config_init()
@@ -91,6 +101,18 @@ char* config_get(config_t type)
     return config[type];
 }
 
+config_t config_find(const char* name)
+{
+    for (size_t type = CONFIG_START; type < CONFIG_MAX; type++)
+    {
+        if (strcmp(config_name[type], name) == 0)
+        {
+            return type;
+        }
+    }
+    return CONFIG_MAX;
+}
+
 void config_reset()
 {
     esp_err_t err = nvs_flash_erase();
@@ -21,12 +21,24 @@ typedef enum
     CONFIG_BASE_LAT,
     CONFIG_BASE_LON,
     CONFIG_BASE_ALT,
+    CONFIG_TUNING_START,  // below are not in the settings form, use config_find and config_set
+    CONFIG_CASTER_HOLD_MS = CONFIG_TUNING_START,
+    CONFIG_RTCM3_BAUD,
+    CONFIG_CASTER_ALIVE_MS,
+    CONFIG_RTCM3_PROFILE,
+    CONFIG_UPLINK_BYTES_S,
+    CONFIG_BASE_SURVEY,        // lat,lon,alt of the last completed survey, restored on boot
+    CONFIG_BASE_TOLERANCE_MM,  // largest distance of the boot fix from the surveyed position
+    CONFIG_LOG_ROTATE_KB,      // SD log file size limit, 0 disables
+    CONFIG_LOG_ROTATE_S,       // SD log file age limit, 0 disables
+    CONFIG_LOG_SYNC_MS,        // least time between flushes on an epoch, 0 only writes full buffers
     CONFIG_MAX
 } config_t;
 
 esp_err_t config_init();
 void config_set(config_t type, const char* value);
 char* config_get(config_t type);
+config_t config_find(const char* name);
 void config_reset();
 
 #endif  // ESP32S3_GNSS_CONFIG_H
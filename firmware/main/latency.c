@@ -0,0 +1,93 @@
+#include "latency.h"
+
+#include <esp_timer.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "util.h"
+
+static const char* LATENCY_NAME[LATENCY_MAX] = {
+    "dispatch",     //
+    "caster_send",  //
+    "uart_write",   //
+};
+
+// written from several tasks on both cores, every counter is updated on its own without a lock
+static struct
+{
+    atomic_uint buckets[LATENCY_BUCKETS];
+    atomic_uint max;  // us
+} stages[LATENCY_MAX];
+
+void latency_record(latency_stage_t stage, int64_t since)
+{
+    int64_t elapsed = esp_timer_get_time() - since;
+    uint32_t us = elapsed > 0 ? (elapsed < UINT32_MAX ? (uint32_t)elapsed : UINT32_MAX) : 0;
+    size_t bucket = us > 1 ? MIN(31 - __builtin_clz(us), LATENCY_BUCKETS - 1) : 0;
+
+    atomic_fetch_add_explicit(&stages[stage].buckets[bucket], 1, memory_order_relaxed);
+
+    // a lost race only retries while this sample is still the larger one
+    uint32_t max = atomic_load_explicit(&stages[stage].max, memory_order_relaxed);
+    while (us > max && !atomic_compare_exchange_weak_explicit(&stages[stage].max, &max, us, memory_order_relaxed, memory_order_relaxed))
+    {
+    }
+}
+
+static uint32_t latency_percentile(const uint32_t* buckets, uint32_t count, uint32_t max, uint32_t percent)
+{
+    // upper bound of the bucket that holds the percentile, never above the largest sample
+    uint64_t target = ((uint64_t)count * percent + 99) / 100;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        sum += buckets[i];
+        if (sum >= target)
+        {
+            return MIN((2u << i) - 1, max);
+        }
+    }
+    return max;
+}
+
+size_t latency_print(char* buffer, size_t len)
+{
+    uint32_t buckets[LATENCY_BUCKETS];
+    size_t pos = 0;
+    int n;
+
+    // one line per stage, hist is the count of each bucket, bucket i ends at 2^(i+1) us
+    for (size_t stage = LATENCY_START; stage < LATENCY_MAX && pos < len - 1; stage++)
+    {
+        uint32_t max = atomic_load_explicit(&stages[stage].max, memory_order_relaxed);
+        uint32_t count = 0;
+        for (size_t i = 0; i < LATENCY_BUCKETS; i++)
+        {
+            buckets[i] = atomic_load_explicit(&stages[stage].buckets[i], memory_order_relaxed);
+            count += buckets[i];
+        }
+
+        n = snprintf(buffer + pos,
+                     len - pos,
+                     "%s=count:%lu,p50_us:%lu,p90_us:%lu,p99_us:%lu,max_us:%lu,hist:",
+                     LATENCY_NAME[stage],
+                     count,
+                     count > 0 ? latency_percentile(buckets, count, max, 50) : 0,
+                     count > 0 ? latency_percentile(buckets, count, max, 90) : 0,
+                     count > 0 ? latency_percentile(buckets, count, max, 99) : 0,
+                     max);
+        for (size_t i = 0; i < LATENCY_BUCKETS && n >= 0 && (size_t)n < len - pos; i++)
+        {
+            pos += n;
+            n = snprintf(buffer + pos, len - pos, i + 1 < LATENCY_BUCKETS ? "%lu/" : "%lu" NEWLINE, buckets[i]);
+        }
+        if (n < 0 || (size_t)n >= len - pos)
+        {
+            break;
+        }
+        pos += n;
+    }
+
+    buffer[pos] = '\0';
+    return pos;
+}
@@ -0,0 +1,23 @@
+#ifndef ESP32S3_GNSS_LATENCY_H
+#define ESP32S3_GNSS_LATENCY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// bucket i counts latencies in [2^i, 2^(i+1)) us, the last one also takes everything longer
+#define LATENCY_BUCKETS 24
+
+// stages of a correction inside the box, each measured from the time its bytes were read
+typedef enum
+{
+    LATENCY_START = 0,
+    LATENCY_DISPATCH = LATENCY_START,  // UART2 read to RTCM3 dispatcher
+    LATENCY_CASTER_SEND,               // UART2 read to httpd_socket_send done, per client
+    LATENCY_UART_WRITE,                // NTRIP client read to ubx_write_rtcm3 done
+    LATENCY_MAX
+} latency_stage_t;
+
+void latency_record(latency_stage_t stage, int64_t since);
+size_t latency_print(char* buffer, size_t len);
+
+#endif  // ESP32S3_GNSS_LATENCY_H
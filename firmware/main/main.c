@@ -1,10 +1,14 @@
 #include <esp_event.h>
 
+#include "base.h"
 #include "battery.h"
+#include "boot.h"
 #include "config.h"
 #include "ntrip_caster.h"
 #include "ntrip_client.h"
 #include "ping.h"
+#include "rtcm3_pool.h"
+#include "sdlog.h"
 #include "status.h"
 #include "uart.h"
 #include "util.h"
@@ -13,6 +17,24 @@
 
 static const char* TAG = "MAIN";
 
+// subsystems that start together, each one waits only for the phases it needs
+static const boot_step_t BOOT_STEPS[] = {
+    // start WiFi AP+STA mode
+    {BOOT_WIFI, wifi_init, 0},
+    // start Web App, mDNS needs the network interfaces
+    {BOOT_WEB_APP, web_app_init, BOOT_BIT(BOOT_WIFI)},
+    // start UART ports, configure the receiver
+    {BOOT_UART, uart_init, 0},
+    // start battery monitor
+    {BOOT_BATTERY, battery_init, 0},
+    // start NTRIP Caster
+    {BOOT_CASTER, ntrip_caster_init, BOOT_BIT(BOOT_WIFI)},
+    // restart a surveyed base in fixed mode, after the receiver got its default configuration
+    {BOOT_BASE, base_init, BOOT_BIT(BOOT_UART)},
+    // record the RTCM3 and UBX streams, the readers skip it until the card is mounted
+    {BOOT_SDLOG, sdlog_init, 0},
+};
+
 void app_main(void)
 {
     ESP_LOGI(TAG, "Starting GNSS Base Station...");
@@ -20,29 +42,31 @@ void app_main(void)
     // create a default event loop for all tasks
     esp_event_loop_create_default();
 
+    // record the startup timeline, see /stats?boot
+    boot_init();
+    boot_begin(BOOT_CONFIG);
+
     // init NVS and load default settings
     config_init();
 
     // init status
     status_init();
 
-    // start WiFi AP+STA mode
-    wifi_init();
-
-    // start Web App
-    web_app_init();
+    // shared RTCM3 frame buffers, the caster registers as a consumer while UART starts
+    rtcm3_pool_init();
 
-    // start UART ports
-    uart_init();
+    boot_end(BOOT_CONFIG);
 
-    // start battery monitor
-    battery_init();
-
-    // start NTRIP Caster
-    ntrip_caster_init();
+    for (size_t i = 0; i < sizeof(BOOT_STEPS) / sizeof(BOOT_STEPS[0]); i++)
+    {
+        boot_start(&BOOT_STEPS[i]);
+    }
 
     // wait for internet
+    boot_wait(BOOT_BIT(BOOT_WIFI));
+    boot_begin(BOOT_IP);
     wait_for_ip();
+    boot_end(BOOT_IP);
     ping(config_get(CONFIG_NTRIP_IP));
 
     // init ntrip client
@@ -0,0 +1,523 @@
+#include "nmea.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ublox.h"
+#include "util.h"
+
+static const char* TAG = "NMEA";
+
+esp_err_t nmea_splitter_init(nmea_splitter_t* splitter, size_t size)
+{
+    // a whole UBX message must always fit after compaction
+    ERROR_IF(size < UBX_MSG_LEN_MAX, return ESP_ERR_INVALID_SIZE, "Splitter buffer is too small: %d", size);
+
+    memset(splitter, 0, sizeof(nmea_splitter_t));
+    splitter->buffer = malloc(size);
+    ERROR_IF(splitter->buffer == NULL, return ESP_ERR_NO_MEM, "Cannot allocate splitter buffer");
+    splitter->size = size;
+
+    return ESP_OK;
+}
+
+void nmea_splitter_deinit(nmea_splitter_t* splitter)
+{
+    free(splitter->buffer);
+    splitter->buffer = NULL;
+    splitter->size = 0;
+}
+
+void nmea_splitter_reset(nmea_splitter_t* splitter)
+{
+    splitter->head = 0;
+    splitter->tail = 0;
+    splitter->discard = false;
+}
+
+char* nmea_splitter_space(nmea_splitter_t* splitter, size_t* len)
+{
+    // move the pending partial line to the front
+    if (splitter->head > 0)
+    {
+        memmove(splitter->buffer, splitter->buffer + splitter->head, splitter->tail - splitter->head);
+        splitter->tail -= splitter->head;
+        splitter->head = 0;
+    }
+
+    *len = splitter->size - splitter->tail;
+    return splitter->buffer + splitter->tail;
+}
+
+void nmea_splitter_commit(nmea_splitter_t* splitter, size_t len)
+{
+    splitter->tail = MIN(splitter->tail + len, splitter->size);
+}
+
+static bool nmea_splitter_ubx(nmea_splitter_t* splitter, const char** data, size_t* len, bool* wait)
+{
+    const uint8_t* start = (const uint8_t*)splitter->buffer + splitter->head;
+    size_t available = splitter->tail - splitter->head;
+
+    *wait = false;
+    if (available < 2 || start[1] != 0x62)
+    {
+        *wait = available < 2;
+        return false;
+    }
+
+    // wait for the header, then for the whole message
+    if (available < UBX_HEADER_LEN)
+    {
+        *wait = true;
+        return false;
+    }
+
+    size_t msg_len = UBX_HEADER_LEN + (start[4] | (start[5] << 8)) + UBX_CHECKSUM_LEN;
+    if (msg_len > UBX_MSG_LEN_MAX)
+    {
+        splitter->ubx_errors++;
+        return false;
+    }
+
+    if (available < msg_len)
+    {
+        *wait = true;
+        return false;
+    }
+
+    if (!ubx_check_msg(start, msg_len))
+    {
+        splitter->ubx_errors++;
+        return false;
+    }
+
+    *data = (const char*)start;
+    *len = msg_len;
+    splitter->head += msg_len;
+    splitter->ubx++;
+    return true;
+}
+
+nmea_split_t nmea_splitter_next(nmea_splitter_t* splitter, const char** data, size_t* len)
+{
+    bool wait;
+
+    while (splitter->head < splitter->tail)
+    {
+        char* start = splitter->buffer + splitter->head;
+        size_t available = splitter->tail - splitter->head;
+
+        // UBX messages are framed by length, resync one byte later if the header is bad
+        if (!splitter->discard && (uint8_t)start[0] == 0xB5)
+        {
+            if (nmea_splitter_ubx(splitter, data, len, &wait))
+            {
+                return NMEA_SPLIT_UBX;
+            }
+            if (wait)
+            {
+                return NMEA_SPLIT_NONE;
+            }
+            splitter->head++;
+            continue;
+        }
+
+        // text up to the next UBX sync byte cannot be a sentence
+        char* end = memchr(start, '\n', available);
+        char* sync = memchr(start, 0xB5, end != NULL ? (size_t)(end - start) : available);
+        if (sync != NULL)
+        {
+            splitter->overflows += splitter->discard ? 0 : 1;
+            splitter->discard = false;
+            splitter->head += sync - start;
+            continue;
+        }
+
+        if (end == NULL)
+        {
+            // no room left for the rest of this line, drop it up to the next '\n'
+            if (available >= NMEA_LINE_LEN_MAX || (splitter->head == 0 && splitter->tail == splitter->size))
+            {
+                ESP_LOGD(TAG, "Drop overlong line");
+                splitter->overflows += splitter->discard ? 0 : 1;
+                splitter->discard = true;
+                splitter->head = 0;
+                splitter->tail = 0;
+            }
+            return NMEA_SPLIT_NONE;
+        }
+
+        splitter->head += end - start + 1;
+
+        // the tail of an overlong line
+        if (splitter->discard)
+        {
+            splitter->discard = false;
+            continue;
+        }
+
+        // a whole overlong line arrived in one read
+        if (end - start >= NMEA_LINE_LEN_MAX)
+        {
+            splitter->overflows++;
+            continue;
+        }
+
+        // terminate the line in place, without "\r\n"
+        *end = '\0';
+        if (end > start && *(end - 1) == '\r')
+        {
+            *(--end) = '\0';
+        }
+
+        *data = start;
+        *len = end - start;
+        splitter->lines++;
+        return NMEA_SPLIT_LINE;
+    }
+
+    return NMEA_SPLIT_NONE;
+}
+
+static int nmea_hex(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+bool nmea_parse(const char* line, size_t len, nmea_index_t* index)
+{
+    uint8_t checksum = 0;
+    size_t i;
+
+    if (len < 4 || line[0] != '$')
+    {
+        return false;
+    }
+
+    // checksum and field offsets in a single pass, nothing is copied
+    index->sentence = line;
+    index->count = 1;
+    index->offset[0] = 1;
+    for (i = 1; i < len && line[i] != '*'; i++)
+    {
+        checksum ^= (uint8_t)line[i];
+        if (line[i] == ',')
+        {
+            index->length[index->count - 1] = i - index->offset[index->count - 1];
+            if (index->count == NMEA_FIELDS_MAX)
+            {
+                return false;
+            }
+            index->offset[index->count++] = i + 1;
+        }
+    }
+    index->length[index->count - 1] = i - index->offset[index->count - 1];
+
+    // "*hh" must end the sentence
+    if (i + 3 != len)
+    {
+        return false;
+    }
+
+    int hi = nmea_hex(line[i + 1]);
+    int lo = nmea_hex(line[i + 2]);
+    return hi >= 0 && lo >= 0 && checksum == ((hi << 4) | lo);
+}
+
+const char* nmea_field(const nmea_index_t* index, int field, size_t* len)
+{
+    if (field >= index->count)
+    {
+        *len = 0;
+        return "";
+    }
+
+    *len = index->length[field];
+    return index->sentence + index->offset[field];
+}
+
+bool nmea_is(const nmea_index_t* index, const char* type)
+{
+    // match the sentence type, whatever the talker is
+    return index->length[0] == 5 && memcmp(index->sentence + index->offset[0] + 2, type, 3) == 0;
+}
+
+static bool nmea_fixed(const nmea_index_t* index, int field, int scale, int64_t* value)
+{
+    size_t len;
+    const char* s = nmea_field(index, field, &len);
+    const char* end = s + len;
+    bool negative = false;
+    bool digits = false;
+    int64_t v = 0;
+
+    if (s < end && (*s == '-' || *s == '+'))
+    {
+        negative = *s++ == '-';
+    }
+
+    for (; s < end && *s >= '0' && *s <= '9'; s++, digits = true)
+    {
+        v = v * 10 + (*s - '0');
+    }
+
+    // pad or truncate the fraction to scale digits
+    if (s < end && *s == '.')
+    {
+        s++;
+    }
+    for (int i = 0; i < scale; i++)
+    {
+        v *= 10;
+        if (s < end && *s >= '0' && *s <= '9')
+        {
+            v += *s++ - '0';
+            digits = true;
+        }
+    }
+    while (s < end && *s >= '0' && *s <= '9')
+    {
+        s++;
+    }
+
+    if (!digits || s != end)
+    {
+        return false;
+    }
+
+    *value = negative ? -v : v;
+    return true;
+}
+
+static bool nmea_time(const nmea_index_t* index, int field, uint32_t* utc_ms)
+{
+    int64_t v;
+
+    // hhmmss.sss
+    if (!nmea_fixed(index, field, 3, &v) || v < 0)
+    {
+        return false;
+    }
+
+    *utc_ms = (v / 10000000) * 3600000 + (v / 100000 % 100) * 60000 + v % 100000;
+    return true;
+}
+
+static bool nmea_coordinate(const nmea_index_t* index, int field, char negative, int64_t* value)
+{
+    int64_t v;
+    size_t len;
+    const char* hemisphere = nmea_field(index, field + 1, &len);
+
+    // (d)ddmm.mmmmmmm, minutes kept to 1e-7 as CFG-NMEA-HIGHPREC prints them
+    if (!nmea_fixed(index, field, 7, &v) || v < 0 || len != 1)
+    {
+        return false;
+    }
+
+    *value = (v / 1000000000) * 1000000000 + ((v % 1000000000) * 5 + 1) / 3;
+    if (*hemisphere == negative)
+    {
+        *value = -*value;
+    }
+    return true;
+}
+
+bool nmea_decode_gga(const nmea_index_t* index, nmea_gga_t* gga)
+{
+    int64_t quality, num_sv, hdop, hmsl, sep;
+
+    if (!nmea_is(index, "GGA") || index->count < 15)
+    {
+        return false;
+    }
+
+    // a GGA without a fix leaves the position empty, callers copy every field
+    memset(gga, 0, sizeof(nmea_gga_t));
+    if (!nmea_time(index, 1, &gga->utc_ms) || !nmea_fixed(index, 6, 0, &quality))
+    {
+        return false;
+    }
+
+    gga->quality = quality;
+    if (quality == 0)
+    {
+        return true;
+    }
+
+    if (!nmea_coordinate(index, 2, 'S', &gga->lat) || !nmea_coordinate(index, 4, 'W', &gga->lon) || !nmea_fixed(index, 7, 0, &num_sv) ||
+        !nmea_fixed(index, 8, 2, &hdop) || !nmea_fixed(index, 9, 4, &hmsl) || !nmea_fixed(index, 11, 4, &sep))
+    {
+        return false;
+    }
+
+    gga->num_sv = num_sv;
+    gga->hdop = hdop;
+    gga->hmsl = hmsl;
+    gga->geoid_sep = sep;
+    return true;
+}
+
+bool nmea_decode_gst(const nmea_index_t* index, nmea_gst_t* gst)
+{
+    int64_t rms, lat, lon, alt;
+
+    if (!nmea_is(index, "GST") || index->count < 9)
+    {
+        return false;
+    }
+
+    if (!nmea_time(index, 1, &gst->utc_ms) || !nmea_fixed(index, 6, 3, &lat) || !nmea_fixed(index, 7, 3, &lon) || !nmea_fixed(index, 8, 3, &alt))
+    {
+        return false;
+    }
+
+    // the range rms may be empty
+    gst->rms = nmea_fixed(index, 2, 3, &rms) ? rms : 0;
+    gst->sigma_lat = lat;
+    gst->sigma_lon = lon;
+    gst->sigma_alt = alt;
+    return true;
+}
+
+bool nmea_decode_rmc(const nmea_index_t* index, nmea_rmc_t* rmc)
+{
+    int64_t speed, course, date;
+    size_t len;
+    const char* status;
+    const char* mode;
+
+    if (!nmea_is(index, "RMC") || index->count < 12)
+    {
+        return false;
+    }
+
+    status = nmea_field(index, 2, &len);
+    rmc->valid = len == 1 && *status == 'A';
+    mode = nmea_field(index, 12, &len);
+    rmc->mode = len == 1 ? *mode : 'N';
+
+    if (!nmea_time(index, 1, &rmc->utc_ms) || !nmea_fixed(index, 9, 0, &date))
+    {
+        return false;
+    }
+    rmc->date = date;
+
+    if (!rmc->valid)
+    {
+        return true;
+    }
+
+    if (!nmea_coordinate(index, 3, 'S', &rmc->lat) || !nmea_coordinate(index, 5, 'W', &rmc->lon) || !nmea_fixed(index, 7, 3, &speed))
+    {
+        return false;
+    }
+
+    rmc->speed = speed;
+    // course is empty when not moving
+    rmc->course = nmea_fixed(index, 8, 2, &course) ? course : 0;
+    return true;
+}
+
+static size_t nmea_finish(char* buffer, size_t len, int n)
+{
+    uint8_t checksum = 0;
+
+    if (n < 0 || (size_t)n >= len)
+    {
+        buffer[0] = '\0';
+        return 0;
+    }
+
+    // xor of everything between '$' and '*'
+    for (int i = 1; i < n; i++)
+    {
+        checksum ^= (uint8_t)buffer[i];
+    }
+
+    int m = snprintf(buffer + n, len - n, "*%02X", checksum);
+    if (m < 0 || (size_t)(n + m) >= len)
+    {
+        buffer[0] = '\0';
+        return 0;
+    }
+    return n + m;
+}
+
+static void nmea_degree(int64_t value, int64_t* degree, int64_t* minute)
+{
+    // 1e-9 deg to whole degrees and 1e-7 minutes, rounded
+    int64_t abs = value < 0 ? -value : value;
+    *degree = abs / 1000000000;
+    *minute = ((abs % 1000000000) * 3 + 2) / 5;
+    if (*minute >= 600000000)
+    {
+        (*degree)++;
+        *minute -= 600000000;
+    }
+}
+
+size_t nmea_gga_print(const status_gnss_t* gnss, char* buffer, size_t len)
+{
+    int64_t lat_deg, lat_min, lon_deg, lon_min;
+    uint32_t hmsl = gnss->hmsl < 0 ? -gnss->hmsl : gnss->hmsl;
+    uint32_t sep = gnss->geoid_sep < 0 ? -gnss->geoid_sep : gnss->geoid_sep;
+
+    nmea_degree(gnss->lat, &lat_deg, &lat_min);
+    nmea_degree(gnss->lon, &lon_deg, &lon_min);
+
+    // same precision as CFG-NMEA-HIGHPREC
+    int n = snprintf(buffer,
+                     len,
+                     "$GNGGA,%02lu%02lu%02lu.%02lu,%02lld%02lld.%07lld,%c,%03lld%02lld.%07lld,%c,%u,%02u,%u.%02u,%s%lu.%04lu,M,%s%lu.%04lu,M,,",
+                     gnss->utc_ms / 3600000,
+                     gnss->utc_ms / 60000 % 60,
+                     gnss->utc_ms / 1000 % 60,
+                     gnss->utc_ms % 1000 / 10,
+                     lat_deg,
+                     lat_min / 10000000,
+                     lat_min % 10000000,
+                     gnss->lat < 0 ? 'S' : 'N',
+                     lon_deg,
+                     lon_min / 10000000,
+                     lon_min % 10000000,
+                     gnss->lon < 0 ? 'W' : 'E',
+                     gnss->quality,
+                     gnss->num_sv,
+                     gnss->dop / 100,
+                     gnss->dop % 100,
+                     gnss->hmsl < 0 ? "-" : "",
+                     hmsl / 10000,
+                     hmsl % 10000,
+                     gnss->geoid_sep < 0 ? "-" : "",
+                     sep / 10000,
+                     sep % 10000);
+    return nmea_finish(buffer, len, n);
+}
+
+size_t nmea_gst_print(const status_gnss_t* gnss, char* buffer, size_t len)
+{
+    // only the standard deviations of latitude, longitude and altitude are known
+    int n = snprintf(buffer,
+                     len,
+                     "$GNGST,%02lu%02lu%02lu.%02lu,,,,,%lu.%03lu,%lu.%03lu,%lu.%03lu",
+                     gnss->utc_ms / 3600000,
+                     gnss->utc_ms / 60000 % 60,
+                     gnss->utc_ms / 1000 % 60,
+                     gnss->utc_ms % 1000 / 10,
+                     gnss->sigma_lat / 1000,
+                     gnss->sigma_lat % 1000,
+                     gnss->sigma_lon / 1000,
+                     gnss->sigma_lon % 1000,
+                     gnss->sigma_alt / 1000,
+                     gnss->sigma_alt % 1000);
+    return nmea_finish(buffer, len, n);
+}
@@ -0,0 +1,94 @@
+#ifndef ESP32S3_GNSS_NMEA_H
+#define ESP32S3_GNSS_NMEA_H
+
+#include <esp_err.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "status.h"
+
+#define NMEA_LINE_LEN_MAX 256
+#define NMEA_FIELDS_MAX   32
+
+typedef enum
+{
+    NMEA_SPLIT_NONE = 0,  // need more bytes
+    NMEA_SPLIT_LINE,      // a '\0' terminated sentence, without "\r\n"
+    NMEA_SPLIT_UBX,       // a whole UBX message with a valid checksum
+} nmea_split_t;
+
+// splitter for the receiver's mixed NMEA/UBX output, bytes are appended at tail, messages are taken from head
+typedef struct
+{
+    char* buffer;
+    size_t size;
+    size_t head;
+    size_t tail;
+    bool discard;         // dropping the rest of an overlong line
+    uint32_t lines;       // number of lines
+    uint32_t overflows;   // number of dropped overlong lines
+    uint32_t ubx;         // number of UBX messages
+    uint32_t ubx_errors;  // number of UBX headers with a bad length or checksum
+} nmea_splitter_t;
+
+esp_err_t nmea_splitter_init(nmea_splitter_t* splitter, size_t size);
+void nmea_splitter_deinit(nmea_splitter_t* splitter);
+void nmea_splitter_reset(nmea_splitter_t* splitter);
+char* nmea_splitter_space(nmea_splitter_t* splitter, size_t* len);
+void nmea_splitter_commit(nmea_splitter_t* splitter, size_t len);
+nmea_split_t nmea_splitter_next(nmea_splitter_t* splitter, const char** data, size_t* len);
+
+// field offsets into a validated sentence, field 0 is the address such as "GNGGA"
+typedef struct
+{
+    const char* sentence;
+    uint8_t count;
+    uint16_t offset[NMEA_FIELDS_MAX];
+    uint16_t length[NMEA_FIELDS_MAX];
+} nmea_index_t;
+
+typedef struct
+{
+    uint32_t utc_ms;    // ms since UTC midnight
+    int64_t lat;        // 1e-9 deg
+    int64_t lon;        // 1e-9 deg
+    uint8_t quality;    // 0 none, 1 single, 2 DGNSS, 4 RTK fixed, 5 RTK float
+    uint8_t num_sv;     // satellites used
+    uint16_t hdop;      // 0.01
+    int32_t hmsl;       // 0.1 mm above mean sea level
+    int32_t geoid_sep;  // 0.1 mm, ellipsoid above mean sea level
+} nmea_gga_t;
+
+typedef struct
+{
+    uint32_t utc_ms;     // ms since UTC midnight
+    uint32_t rms;        // mm, of the pseudorange residuals
+    uint32_t sigma_lat;  // mm
+    uint32_t sigma_lon;  // mm
+    uint32_t sigma_alt;  // mm
+} nmea_gst_t;
+
+typedef struct
+{
+    uint32_t utc_ms;  // ms since UTC midnight
+    bool valid;       // status 'A'
+    int64_t lat;      // 1e-9 deg
+    int64_t lon;      // 1e-9 deg
+    uint32_t speed;   // 0.001 knot
+    uint32_t course;  // 0.01 deg
+    uint32_t date;    // ddmmyy
+    char mode;        // A autonomous, D differential, F float RTK, R RTK, N no fix
+} nmea_rmc_t;
+
+bool nmea_parse(const char* line, size_t len, nmea_index_t* index);
+const char* nmea_field(const nmea_index_t* index, int field, size_t* len);
+bool nmea_is(const nmea_index_t* index, const char* type);
+bool nmea_decode_gga(const nmea_index_t* index, nmea_gga_t* gga);
+bool nmea_decode_gst(const nmea_index_t* index, nmea_gst_t* gst);
+bool nmea_decode_rmc(const nmea_index_t* index, nmea_rmc_t* rmc);
+
+size_t nmea_gga_print(const status_gnss_t* gnss, char* buffer, size_t len);
+size_t nmea_gst_print(const status_gnss_t* gnss, char* buffer, size_t len);
+
+#endif  // ESP32S3_GNSS_NMEA_H
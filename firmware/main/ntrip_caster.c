@@ -2,29 +2,53 @@
 
 #include <esp_err.h>
 #include <esp_event.h>
+#include <esp_heap_caps.h>
 #include <esp_http_server.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <freertos/task.h>
 #include <string.h>
 #include <sys/queue.h>
 #include <sys/socket.h>
 
+#include "config.h"
+#include "latency.h"
+#include "rtcm3.h"
+#include "rtcm3_pool.h"
 #include "status.h"
 #include "uart.h"
 #include "util.h"
 
 static const char* TAG = "NTRIP_CASTER";
 
+#define CASTER_MOUNTPOINT       "/BASE"
+#define CASTER_EPOCH_BUFFER_LEN 8192
+#define CASTER_HOLD_MS_DEFAULT  100
+#define CASTER_ALIVE_MS_DEFAULT 1000
+#define CASTER_STATION_LEN_MAX  64  // 1005 and 1006 frames are 25 and 27 bytes
+#define CASTER_EPOCH_FRAMES_MAX 64
+#define CASTER_QUERY_LEN        128
+
 typedef struct ntrip_caster_client_t
 {
     httpd_handle_t hd;
     int socket;
+    int64_t last_send;         // us, when anything was last sent to this client
+    int64_t idle_max;          // us, longest gap between two sends
+    uint32_t keepalive_bytes;  // bytes of station frames resent while idle
+    bool filtered;             // false: every message type is sent
+    rtcm3_filter_t filter;     // allowed message types
+    uint32_t filtered_bytes;   // bytes not sent because of the filter
     SLIST_ENTRY(ntrip_caster_client_t)
     next;
 } ntrip_caster_client_t;
 
 static SLIST_HEAD(caster_clients_list_t, ntrip_caster_client_t) caster_clients_list;
 
+// the list is walked by the RTCM3 dispatcher and changed by httpd tasks
+static SemaphoreHandle_t caster_clients_lock = NULL;
+
 static char TABLE_RESPONSE[] = "SOURCETABLE 200 OK" CARRET NEWLINE "Content-Type: text/plain" CARRET NEWLINE "Content-Length: 115" CARRET NEWLINE CARRET NEWLINE
                                "STR;BASE;BASE;RTCM 3;;2;GPS+GLO+GAL+BDS+QZSS;GNSS;VN;21.028511;105.804817;0;0;GNSS;none;N;N;9600;" CARRET NEWLINE
                                "ENDSOURCETABLE" CARRET NEWLINE CARRET NEWLINE;
@@ -33,6 +57,42 @@ static char STREAM_RESPONSE[] = "ICY 200 OK" CARRET NEWLINE;
 
 static char client_count = 0;
 
+// frames of the current epoch, sent to each client at once
+static struct
+{
+    uint8_t* buffer;
+    size_t len;
+    int64_t start;     // us, when the first frame arrived
+    int64_t received;  // us, when the first frame was read from the UART
+    int64_t hold_us;   // max time to hold a frame, 0 disables coalescing
+    bool has_msm;
+    uint16_t system;  // MSM type / 10 of the first MSM
+    uint32_t time;    // epoch time of the first MSM
+    size_t frames;
+    uint16_t offset[CASTER_EPOCH_FRAMES_MAX + 1];  // start of each frame, and the end
+} epoch = {0};
+
+static struct
+{
+    uint32_t frames;
+    uint32_t epochs;
+    uint32_t sends;
+    uint32_t flush_end;        // last MSM of the epoch
+    uint32_t flush_new_epoch;  // next epoch started
+    uint32_t flush_full;       // epoch buffer full
+    uint32_t flush_deadline;   // held for hold_us
+} caster_stats = {0};
+
+// last 1005/1006 frame, resent to clients that have been idle for alive_us
+static struct
+{
+    uint8_t frame[CASTER_STATION_LEN_MAX];
+    size_t len;
+    int64_t alive_us;  // 0 disables resending, TCP keepalive still probes the socket
+    uint32_t sends;
+    uint32_t bytes;
+} station = {0};
+
 static esp_err_t mount_table_handler(httpd_req_t* req)
 {
     httpd_handle_t hd = req->handle;
@@ -58,32 +118,243 @@ static void ntrip_caster_client_remove(ntrip_caster_client_t* caster_client)
     free(caster_client);
     client_count--;
     sprintf(status_get(STATUS_NTRIP_CAS_STATUS), "%d", client_count);
+    ubx_update_profile(client_count);
+}
+
+static bool ntrip_caster_client_send(ntrip_caster_client_t* client, const uint8_t* data, size_t len, int64_t now, int64_t received)
+{
+    // ESP_LOGW(TAG, "found socket: %d", client->socket);
+    int sent = httpd_socket_send(client->hd, client->socket, (const char*)data, len, MSG_MORE);
+    ERROR_IF(sent < 0, ntrip_caster_client_remove(client); return false, "delete socket %d", client->socket);
+
+    // keepalives have no UART time
+    if (received > 0)
+    {
+        latency_record(LATENCY_CASTER_SEND, received);
+    }
+
+    client->idle_max = MAX(client->idle_max, now - client->last_send);
+    client->last_send = now;
+    return true;
 }
 
-static void uart_rtcm3_read_event_handler(void* event_handler_arg, esp_event_base_t event_base, int32_t event_id, void* event_data)
+static void ntrip_caster_send(const uint8_t* data, size_t len, int64_t received)
 {
-    // ESP_LOGW(TAG, "Got RTCM3: %s", (char *)event_data);
+    int64_t now = esp_timer_get_time();
+    bool frame = len >= RTCM3_HEADER_LEN + 2 && data[0] == RTCM3_PREAMBLE;
     ntrip_caster_client_t *client, *client_tmp;
     SLIST_FOREACH_SAFE(client, &caster_clients_list, next, client_tmp)
     {
-        // ESP_LOGW(TAG, "found socket: %d", client->socket);
-        int len = httpd_socket_send(client->hd, client->socket, event_data, event_id, MSG_MORE);
-        ERROR_IF(len < 0, ntrip_caster_client_remove(client), "delete socket %d", client->socket);
+        if (client->filtered && frame && !rtcm3_filter_match(&client->filter, data))
+        {
+            client->filtered_bytes += len;
+            continue;
+        }
+        ntrip_caster_client_send(client, data, len, now, received);
+        caster_stats.sends++;
     }
 }
 
-static void custom_httpd_close_func(httpd_handle_t hd, int sockfd)
+static void ntrip_caster_send_epoch(ntrip_caster_client_t* client, int64_t now)
 {
-    // if socket is in the streaming list
-    bool found = false;
+    size_t start = 0;
+
+    // send runs of allowed frames straight from the epoch buffer
+    for (size_t i = 0; i <= epoch.frames; i++)
+    {
+        if (i < epoch.frames && rtcm3_filter_match(&client->filter, epoch.buffer + epoch.offset[i]))
+        {
+            continue;
+        }
+
+        if (i > start)
+        {
+            if (!ntrip_caster_client_send(client, epoch.buffer + epoch.offset[start], epoch.offset[i] - epoch.offset[start], now, epoch.received))
+            {
+                return;
+            }
+            caster_stats.sends++;
+        }
+        if (i < epoch.frames)
+        {
+            client->filtered_bytes += epoch.offset[i + 1] - epoch.offset[i];
+        }
+        start = i + 1;
+    }
+}
+
+static void ntrip_caster_keepalive(int64_t now)
+{
+    ntrip_caster_client_t *client, *client_tmp;
+
+    if (station.alive_us == 0 || station.len == 0)
+    {
+        return;
+    }
+
+    // a valid frame the rover already knows, instead of bytes it would have to skip
+    SLIST_FOREACH_SAFE(client, &caster_clients_list, next, client_tmp)
+    {
+        if (now - client->last_send < station.alive_us || (client->filtered && !rtcm3_filter_match(&client->filter, station.frame)))
+        {
+            continue;
+        }
+
+        if (ntrip_caster_client_send(client, station.frame, station.len, now, 0))
+        {
+            client->keepalive_bytes += station.len;
+            station.sends++;
+            station.bytes += station.len;
+        }
+    }
+}
+
+static void ntrip_caster_epoch_flush(uint32_t* reason)
+{
+    if (epoch.len == 0)
+    {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
     ntrip_caster_client_t *client, *client_tmp;
     SLIST_FOREACH_SAFE(client, &caster_clients_list, next, client_tmp)
+    {
+        if (client->filtered)
+        {
+            ntrip_caster_send_epoch(client, now);
+        }
+        else if (ntrip_caster_client_send(client, epoch.buffer, epoch.len, now, epoch.received))
+        {
+            caster_stats.sends++;
+        }
+    }
+    caster_stats.epochs++;
+    if (reason != NULL)
+    {
+        (*reason)++;
+    }
+
+    epoch.len = 0;
+    epoch.frames = 0;
+    epoch.has_msm = false;
+}
+
+static void rtcm3_consumer(rtcm3_buffer_t* buffer)
+{
+    int64_t now = esp_timer_get_time();
+
+    xSemaphoreTake(caster_clients_lock, portMAX_DELAY);
+
+    // keep the station position for idle keepalives
+    if (buffer != NULL && buffer->len <= CASTER_STATION_LEN_MAX && buffer->len > RTCM3_HEADER_LEN + 2 && buffer->data[0] == RTCM3_PREAMBLE)
+    {
+        uint16_t type = rtcm3_msg_type(buffer->data);
+        if (type == 1005 || type == 1006)
+        {
+            memcpy(station.frame, buffer->data, buffer->len);
+            station.len = buffer->len;
+        }
+    }
+
+    // idle tick, or coalescing is off
+    if (buffer == NULL || epoch.hold_us == 0)
+    {
+        if (epoch.len > 0 && now - epoch.start >= epoch.hold_us)
+        {
+            ntrip_caster_epoch_flush(&caster_stats.flush_deadline);
+        }
+        if (buffer != NULL)
+        {
+            ntrip_caster_send(buffer->data, buffer->len, buffer->received);
+        }
+        else if (epoch.len == 0)
+        {
+            ntrip_caster_keepalive(now);
+        }
+        goto rtcm3_consumer_end;
+    }
+
+    caster_stats.frames++;
+
+    // not a frame, pass it through in order
+    if (buffer->len < RTCM3_HEADER_LEN + RTCM3_CRC_LEN || buffer->data[0] != RTCM3_PREAMBLE)
+    {
+        ntrip_caster_epoch_flush(NULL);
+        ntrip_caster_send(buffer->data, buffer->len, buffer->received);
+        goto rtcm3_consumer_end;
+    }
+
+    uint16_t type = rtcm3_msg_type(buffer->data);
+    bool is_msm = rtcm3_is_msm(type);
+    uint32_t time = is_msm ? rtcm3_msm_epoch(buffer->data) : 0;
+
+    // a new epoch of the same GNSS started without closing the previous one
+    if (is_msm && epoch.has_msm && type / 10 == epoch.system && time != epoch.time)
+    {
+        ntrip_caster_epoch_flush(&caster_stats.flush_new_epoch);
+    }
+
+    if (epoch.len + buffer->len > CASTER_EPOCH_BUFFER_LEN || epoch.frames == CASTER_EPOCH_FRAMES_MAX)
+    {
+        ntrip_caster_epoch_flush(&caster_stats.flush_full);
+    }
+
+    if (epoch.len == 0)
+    {
+        epoch.start = now;
+        epoch.received = buffer->received;
+    }
+    memcpy(epoch.buffer + epoch.len, buffer->data, buffer->len);
+    epoch.offset[epoch.frames++] = epoch.len;
+    epoch.len += buffer->len;
+    epoch.offset[epoch.frames] = epoch.len;
+
+    if (is_msm && !epoch.has_msm)
+    {
+        epoch.has_msm = true;
+        epoch.system = type / 10;
+        epoch.time = time;
+    }
+
+    // the last MSM of the epoch clears the multiple message bit
+    if (is_msm && !rtcm3_msm_multiple(buffer->data))
+    {
+        ntrip_caster_epoch_flush(&caster_stats.flush_end);
+    }
+    // on every frame too, a lost last MSM must not hold a continuous stream until the buffer fills
+    else if (now - epoch.start >= epoch.hold_us)
+    {
+        ntrip_caster_epoch_flush(&caster_stats.flush_deadline);
+    }
+
+rtcm3_consumer_end:
+    xSemaphoreGive(caster_clients_lock);
+}
+
+static bool ntrip_caster_client_exists(int sockfd)
+{
+    bool found = false;
+    ntrip_caster_client_t* client;
+
+    xSemaphoreTake(caster_clients_lock, portMAX_DELAY);
+    SLIST_FOREACH(client, &caster_clients_list, next)
     {
         if (client->socket == sockfd)
         {
             found = true;
+            break;
         }
     }
+    xSemaphoreGive(caster_clients_lock);
+
+    return found;
+}
+
+static void custom_httpd_close_func(httpd_handle_t hd, int sockfd)
+{
+    // if socket is in the streaming list
+    bool found = ntrip_caster_client_exists(sockfd);
 
     // if not, then close it
     if (!found)
@@ -92,21 +363,179 @@ static void custom_httpd_close_func(httpd_handle_t hd, int sockfd)
     }
 }
 
+static bool ntrip_caster_mountpoint(const char* uri)
+{
+    const char* suffix = uri + strlen(CASTER_MOUNTPOINT);
+    size_t len;
+
+    // "/BASE" exactly, or "/BASE-" and one or more "-" separated GNSS names, before any query
+    if (*suffix == '\0' || *suffix == '?')
+    {
+        return true;
+    }
+
+    while (*suffix == '-')
+    {
+        suffix++;
+        len = strcspn(suffix, "-?");
+        if (rtcm3_gnss_find(suffix, len) == RTCM3_GNSS_COUNT)
+        {
+            return false;
+        }
+        suffix += len;
+    }
+
+    return *suffix == '\0' || *suffix == '?';
+}
+
+static bool ntrip_caster_filter_types(rtcm3_filter_t* filter, const char* list)
+{
+    bool found = false;
+    char* end;
+
+    // only the listed message types
+    rtcm3_filter_fill(filter, false);
+    while (*list != '\0')
+    {
+        long type = strtol(list, &end, 10);
+        if (end == list)
+        {
+            list++;
+            continue;
+        }
+        if (type > 0 && type < 4096)
+        {
+            rtcm3_filter_set(filter, type, true);
+            found = true;
+        }
+        list = end;
+    }
+
+    return found;
+}
+
+static void ntrip_caster_client_filter(httpd_req_t* req, ntrip_caster_client_t* client)
+{
+    char* query = calloc(CASTER_QUERY_LEN, sizeof(char));
+    char* value = calloc(CASTER_QUERY_LEN, sizeof(char));
+    const char* suffix = req->uri + strlen(CASTER_MOUNTPOINT);
+
+    client->filtered = false;
+    rtcm3_filter_fill(&client->filter, true);
+    ERROR_IF(query == NULL || value == NULL, goto ntrip_caster_client_filter_end, "Cannot allocate filter buffers");
+
+    // "/BASE-GPS-GAL", the names end at the query
+    if (*suffix == '-')
+    {
+        client->filtered |= rtcm3_filter_gnss(&client->filter, suffix, strcspn(suffix, "?"), "-");
+    }
+
+    // "?gnss=GPS+GAL" narrows further, "?types=1005,1074,1094" replaces it
+    if (httpd_req_get_url_query_str(req, query, CASTER_QUERY_LEN) == ESP_OK)
+    {
+        if (httpd_query_key_value(query, "gnss", value, CASTER_QUERY_LEN) == ESP_OK)
+        {
+            rtcm3_filter_t gnss;
+            rtcm3_filter_fill(&gnss, true);
+            if (rtcm3_filter_gnss(&gnss, value, strlen(value), "+, "))
+            {
+                rtcm3_filter_intersect(&client->filter, &gnss);
+                client->filtered = true;
+            }
+        }
+        if (httpd_query_key_value(query, "types", value, CASTER_QUERY_LEN) == ESP_OK)
+        {
+            client->filtered = ntrip_caster_filter_types(&client->filter, value);
+            if (!client->filtered)
+            {
+                rtcm3_filter_fill(&client->filter, true);
+            }
+        }
+    }
+
+ntrip_caster_client_filter_end:
+    free(value);
+    free(query);
+}
+
 static esp_err_t base_stream_handler(httpd_req_t* req)
 {
+    // the handler is registered for "/BASE*", anything but the mountpoint and its GNSS variants is unknown
+    if (!ntrip_caster_mountpoint(req->uri))
+    {
+        return httpd_resp_send_404(req);
+    }
+
     ntrip_caster_client_t* client = malloc(sizeof(ntrip_caster_client_t));
     client->hd = req->handle;
     client->socket = httpd_req_to_sockfd(req);
-    ESP_LOGI(TAG, "new socket: %d", client->socket);
+    client->last_send = esp_timer_get_time();
+    client->idle_max = 0;
+    client->keepalive_bytes = 0;
+    client->filtered_bytes = 0;
+    ntrip_caster_client_filter(req, client);
+    ESP_LOGI(TAG, "new socket: %d, filtered: %d", client->socket, client->filtered);
+
+    // send the response before any frame can reach this socket
+    xSemaphoreTake(caster_clients_lock, portMAX_DELAY);
     SLIST_INSERT_HEAD(&caster_clients_list, client, next);
     client_count++;
     sprintf(status_get(STATUS_NTRIP_CAS_STATUS), "%d", client_count);
 
     httpd_socket_send(client->hd, client->socket, STREAM_RESPONSE, strlen(STREAM_RESPONSE), MSG_MORE);
+    xSemaphoreGive(caster_clients_lock);
+
+    // one more copy of the stream on the uplink
+    ubx_update_profile(client_count);
 
     return ESP_OK;
 }
 
+size_t ntrip_caster_stats_print(char* buffer, size_t len)
+{
+    int64_t now = esp_timer_get_time();
+    ntrip_caster_client_t* client;
+    size_t pos = 0;
+
+    int n = snprintf(buffer,
+                     len,
+                     "clients=%d" NEWLINE "hold_ms=%lld" NEWLINE "frames=%lu" NEWLINE "epochs=%lu" NEWLINE "sends=%lu" NEWLINE "flush_end=%lu" NEWLINE
+                     "flush_new_epoch=%lu" NEWLINE "flush_full=%lu" NEWLINE "flush_deadline=%lu" NEWLINE "alive_ms=%lld" NEWLINE "keepalive_sends=%lu" NEWLINE
+                     "keepalive_bytes=%lu" NEWLINE,
+                     client_count,
+                     epoch.hold_us / 1000,
+                     caster_stats.frames,
+                     caster_stats.epochs,
+                     caster_stats.sends,
+                     caster_stats.flush_end,
+                     caster_stats.flush_new_epoch,
+                     caster_stats.flush_full,
+                     caster_stats.flush_deadline,
+                     station.alive_us / 1000,
+                     station.sends,
+                     station.bytes);
+    pos = n < 0 ? 0 : MIN((size_t)n, len - 1);
+
+    // one line per client, keyed by socket
+    xSemaphoreTake(caster_clients_lock, portMAX_DELAY);
+    SLIST_FOREACH(client, &caster_clients_list, next)
+    {
+        n = snprintf(buffer + pos,
+                     len - pos,
+                     "client_%d=idle_ms:%lld,idle_max_ms:%lld,keepalive_bytes:%lu,filtered:%d,filtered_bytes:%lu" NEWLINE,
+                     client->socket,
+                     (now - client->last_send) / 1000,
+                     client->idle_max / 1000,
+                     client->keepalive_bytes,
+                     client->filtered,
+                     client->filtered_bytes);
+        pos = n < 0 ? pos : MIN(pos + n, len - 1);
+    }
+    xSemaphoreGive(caster_clients_lock);
+
+    return pos;
+}
+
 httpd_uri_t _mount_table_handler = {
     .uri = "/",
     .method = HTTP_GET,
@@ -115,7 +544,7 @@ httpd_uri_t _mount_table_handler = {
 };
 
 httpd_uri_t _base_stream_handler = {
-    .uri = "/BASE",
+    .uri = CASTER_MOUNTPOINT "*",
     .method = HTTP_GET,
     .handler = base_stream_handler,
     .user_ctx = NULL,
@@ -126,15 +555,7 @@ esp_err_t custom_httpd_err_func(httpd_req_t* req, httpd_err_code_t error)
     int sockfd = httpd_req_to_sockfd(req);
 
     // if socket is in the streaming list
-    bool found = false;
-    ntrip_caster_client_t *client, *client_tmp;
-    SLIST_FOREACH_SAFE(client, &caster_clients_list, next, client_tmp)
-    {
-        if (client->socket == sockfd)
-        {
-            found = true;
-        }
-    }
+    bool found = ntrip_caster_client_exists(sockfd);
 
     // if it is, keep socket open
     if (found)
@@ -150,6 +571,20 @@ esp_err_t ntrip_caster_init()
 {
     esp_err_t err = ESP_OK;
 
+    caster_clients_lock = xSemaphoreCreateMutex();
+    ERROR_IF(caster_clients_lock == NULL, return ESP_ERR_NO_MEM, "Cannot create caster clients lock");
+
+    epoch.buffer = heap_caps_malloc(CASTER_EPOCH_BUFFER_LEN, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    ERROR_IF(epoch.buffer == NULL, return ESP_ERR_NO_MEM, "Cannot allocate caster epoch buffer");
+
+    char* hold_ms = config_get(CONFIG_CASTER_HOLD_MS);
+    epoch.hold_us = (strlen(hold_ms) > 0 ? atoi(hold_ms) : CASTER_HOLD_MS_DEFAULT) * 1000LL;
+    ESP_LOGI(TAG, "Epoch max hold: %lld ms", epoch.hold_us / 1000);
+
+    char* alive_ms = config_get(CONFIG_CASTER_ALIVE_MS);
+    station.alive_us = (strlen(alive_ms) > 0 ? atoi(alive_ms) : CASTER_ALIVE_MS_DEFAULT) * 1000LL;
+    ESP_LOGI(TAG, "Idle keepalive: %lld ms", station.alive_us / 1000);
+
     httpd_handle_t server = NULL;
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.server_port = 2101;
@@ -175,7 +610,8 @@ esp_err_t ntrip_caster_init()
 
     ESP_LOGI(TAG, "Starting NTRIP Server on port %d", config.server_port);
 
-    uart_register_handler(UART_RTCM3_EVENT_READ, uart_rtcm3_read_event_handler);
+    err = rtcm3_pool_register_consumer(rtcm3_consumer);
+    ERROR_IF(err != ESP_OK, return err, "Cannot subscribe to RTCM3 frames");
 
     sprintf(status_get(STATUS_NTRIP_CAS_STATUS), "%d", client_count);
     return err;
@@ -2,7 +2,9 @@
 #define ESP32S3_GNSS_NTRIP_CASTER_H
 
 #include <esp_err.h>
+#include <stddef.h>
 
 esp_err_t ntrip_caster_init();
+size_t ntrip_caster_stats_print(char* buffer, size_t len);
 
 #endif  // ESP32S3_GNSS_NTRIP_CASTER_H
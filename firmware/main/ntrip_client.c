@@ -3,13 +3,16 @@
 #include <esp_err.h>
 #include <esp_event.h>
 #include <esp_http_client.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "config.h"
+#include "latency.h"
 #include "ping.h"
+#include "rtcm3.h"
 #include "status.h"
 #include "uart.h"
 #include "util.h"
@@ -212,16 +215,39 @@ static void ntrip_client_stream_task(void* args)
 
     status_set(STATUS_NTRIP_CLI_STATUS, "Connected");
 
-    char* buffer = malloc(BUFFER_SIZE);
+    // only forward whole, validated frames to the receiver
+    rtcm3_framer_t framer;
+    err = rtcm3_framer_init(&framer, BUFFER_SIZE);
+    ERROR_IF(err != ESP_OK, goto ntrip_client_stream_task_unregister, "Cannot allocate RTCM3 framer");
+
+    const uint8_t* frame;
+    uint8_t* space;
+    size_t space_len;
+    size_t frame_len;
+    int64_t received;
     int len;
-    while ((len = esp_http_client_read(ntrip_client, buffer, BUFFER_SIZE)) >= 0)
+    while (true)
     {
-        ubx_write_rtcm3(buffer, len);
+        space = rtcm3_framer_space(&framer, &space_len);
+        len = esp_http_client_read(ntrip_client, (char*)space, space_len);
+        if (len < 0)
+            break;
+        received = esp_timer_get_time();
+
+        rtcm3_framer_commit(&framer, len);
+        while (rtcm3_framer_next(&framer, &frame, &frame_len))
+        {
+            ubx_write_rtcm3((const char*)frame, frame_len);
+            latency_record(LATENCY_UART_WRITE, received);
+        }
+
         if (isRequestedDisconnect)
             break;
     }
 
-    free(buffer);
+    rtcm3_framer_deinit(&framer);
+
+ntrip_client_stream_task_unregister:
     uart_unregister_handler(UART_STATUS_EVENT_READ, uart_status_read_event_handler);
 
 ntrip_client_stream_task_end:
@@ -0,0 +1,283 @@
+#include "rtcm3.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ublox.h"
+#include "util.h"
+
+static const char* TAG = "RTCM3";
+
+// GNSS names accepted in "/BASE-GPS-GAL" or "?gnss=GPS+GAL", with the messages that belong to each
+static const struct
+{
+    const char* name;
+    uint16_t msm;  // MSM types are msm * 10 + 1..7
+    uint16_t others[2];
+} RTCM3_GNSS[RTCM3_GNSS_COUNT] = {
+    {"GPS", 107, {1019, 0}},
+    {"GLO", 108, {1020, 1230}},
+    {"GAL", 109, {1045, 1046}},
+    {"SBAS", 110, {0, 0}},
+    {"QZS", 111, {1044, 0}},
+    {"BDS", 112, {1042, 0}},
+    {"IRN", 113, {1041, 0}},
+};
+
+esp_err_t rtcm3_framer_init(rtcm3_framer_t* framer, size_t size)
+{
+    // a full frame must always fit after compaction
+    ERROR_IF(size <= RTCM3_FRAME_LEN_MAX, return ESP_ERR_INVALID_SIZE, "Framer buffer is too small: %d", size);
+
+    memset(framer, 0, sizeof(rtcm3_framer_t));
+    framer->buffer = malloc(size);
+    ERROR_IF(framer->buffer == NULL, return ESP_ERR_NO_MEM, "Cannot allocate framer buffer");
+    framer->size = size;
+
+    return ESP_OK;
+}
+
+void rtcm3_framer_deinit(rtcm3_framer_t* framer)
+{
+    free(framer->buffer);
+    framer->buffer = NULL;
+    framer->size = 0;
+}
+
+void rtcm3_framer_reset(rtcm3_framer_t* framer)
+{
+    framer->head = 0;
+    framer->tail = 0;
+}
+
+uint8_t* rtcm3_framer_space(rtcm3_framer_t* framer, size_t* len)
+{
+    // move the pending partial frame to the front, it is never longer than one frame
+    if (framer->head > 0)
+    {
+        memmove(framer->buffer, framer->buffer + framer->head, framer->tail - framer->head);
+        framer->tail -= framer->head;
+        framer->head = 0;
+    }
+
+    *len = framer->size - framer->tail;
+    return framer->buffer + framer->tail;
+}
+
+void rtcm3_framer_commit(rtcm3_framer_t* framer, size_t len)
+{
+    framer->tail = MIN(framer->tail + len, framer->size);
+}
+
+bool rtcm3_framer_next(rtcm3_framer_t* framer, const uint8_t** frame, size_t* len)
+{
+    while (framer->head < framer->tail)
+    {
+        uint8_t* start = framer->buffer + framer->head;
+        size_t available = framer->tail - framer->head;
+
+        // skip garbage up to the next preamble
+        uint8_t* preamble = memchr(start, RTCM3_PREAMBLE, available);
+        if (preamble == NULL)
+        {
+            framer->skipped += available;
+            rtcm3_framer_reset(framer);
+            return false;
+        }
+
+        framer->skipped += preamble - start;
+        framer->head += preamble - start;
+        available = framer->tail - framer->head;
+
+        // wait for the header
+        if (available < RTCM3_HEADER_LEN)
+        {
+            return false;
+        }
+
+        // 6 reserved bits must be zero
+        if (preamble[1] & 0xFC)
+        {
+            framer->skipped++;
+            framer->head++;
+            continue;
+        }
+
+        // wait for the whole frame
+        size_t payload_len = ((preamble[1] & 0x03) << 8) | preamble[2];
+        size_t frame_len = RTCM3_HEADER_LEN + payload_len + RTCM3_CRC_LEN;
+        if (available < frame_len)
+        {
+            return false;
+        }
+
+        // on CRC mismatch, resync from the byte after this preamble
+        const uint8_t* crc = preamble + RTCM3_HEADER_LEN + payload_len;
+        if (crc24q(preamble, RTCM3_HEADER_LEN + payload_len) != (((uint32_t)crc[0] << 16) | ((uint32_t)crc[1] << 8) | crc[2]))
+        {
+            ESP_LOGD(TAG, "CRC error, len=%d", frame_len);
+            framer->crc_errors++;
+            if (framer->crc_error != NULL)
+            {
+                framer->crc_error(preamble, frame_len);
+            }
+            framer->skipped++;
+            framer->head++;
+            continue;
+        }
+
+        *frame = preamble;
+        *len = frame_len;
+        framer->head += frame_len;
+        framer->frames++;
+        return true;
+    }
+
+    return false;
+}
+
+uint32_t rtcm3_getbitu(const uint8_t* buff, int pos, int len)
+{
+    uint32_t bits = 0;
+    for (int i = pos; i < pos + len; i++)
+    {
+        bits = (bits << 1) | ((buff[i / 8] >> (7 - i % 8)) & 1u);
+    }
+    return bits;
+}
+
+uint16_t rtcm3_msg_type(const uint8_t* frame)
+{
+    // first 12 bits of the payload
+    return ((uint16_t)frame[RTCM3_HEADER_LEN] << 4) | (frame[RTCM3_HEADER_LEN + 1] >> 4);
+}
+
+bool rtcm3_is_msm(uint16_t type)
+{
+    // MSM1..MSM7 of GPS, GLONASS, Galileo, SBAS, QZSS, BeiDou, NavIC
+    return type >= 1071 && type <= 1137 && type % 10 >= 1 && type % 10 <= 7;
+}
+
+uint32_t rtcm3_msm_epoch(const uint8_t* frame)
+{
+    // after message type (12) and station id (12), GLONASS packs day of week in the top 3 bits
+    return rtcm3_getbitu(frame, 24 + 24, 30);
+}
+
+bool rtcm3_msm_multiple(const uint8_t* frame)
+{
+    // set when more MSMs follow for the same epoch
+    return rtcm3_getbitu(frame, 24 + 54, 1);
+}
+
+size_t rtcm3_type_slot(uint16_t type)
+{
+    if (type >= RTCM3_TYPE_STD_FIRST && type < RTCM3_TYPE_STD_FIRST + RTCM3_TYPE_STD_COUNT)
+    {
+        return type - RTCM3_TYPE_STD_FIRST;
+    }
+    if (type >= RTCM3_TYPE_PROP_FIRST && type < RTCM3_TYPE_PROP_FIRST + RTCM3_TYPE_PROP_COUNT)
+    {
+        return RTCM3_TYPE_STD_COUNT + type - RTCM3_TYPE_PROP_FIRST;
+    }
+    return RTCM3_TYPE_SLOTS - 1;
+}
+
+uint16_t rtcm3_slot_type(size_t slot)
+{
+    if (slot < RTCM3_TYPE_STD_COUNT)
+    {
+        return RTCM3_TYPE_STD_FIRST + slot;
+    }
+    if (slot < RTCM3_TYPE_STD_COUNT + RTCM3_TYPE_PROP_COUNT)
+    {
+        return RTCM3_TYPE_PROP_FIRST + slot - RTCM3_TYPE_STD_COUNT;
+    }
+    return 0;
+}
+
+void rtcm3_filter_fill(rtcm3_filter_t* filter, bool all)
+{
+    memset(filter->bits, all ? 0xFF : 0x00, sizeof(filter->bits));
+}
+
+void rtcm3_filter_set(rtcm3_filter_t* filter, uint16_t type, bool allow)
+{
+    size_t slot = rtcm3_type_slot(type);
+    if (allow)
+    {
+        filter->bits[slot / 32] |= 1u << (slot % 32);
+    }
+    else
+    {
+        filter->bits[slot / 32] &= ~(1u << (slot % 32));
+    }
+}
+
+void rtcm3_filter_intersect(rtcm3_filter_t* filter, const rtcm3_filter_t* other)
+{
+    for (size_t i = 0; i < sizeof(filter->bits) / sizeof(filter->bits[0]); i++)
+    {
+        filter->bits[i] &= other->bits[i];
+    }
+}
+
+size_t rtcm3_gnss_find(const char* name, size_t len)
+{
+    // whole names only, "GA" and "GALX" are not "GAL"
+    size_t i = 0;
+    while (i < RTCM3_GNSS_COUNT && (strlen(RTCM3_GNSS[i].name) != len || strncmp(name, RTCM3_GNSS[i].name, len) != 0))
+    {
+        i++;
+    }
+    return i;
+}
+
+bool rtcm3_filter_gnss(rtcm3_filter_t* filter, const char* list, size_t len, const char* separators)
+{
+    bool listed[RTCM3_GNSS_COUNT] = {false};
+    bool found = false;
+    const char* end = list + len;
+
+    // the first len bytes of list, split at any of separators; unknown names are ignored
+    while (list < end)
+    {
+        size_t n = 0;
+        while (list + n < end && strchr(separators, list[n]) == NULL)
+        {
+            n++;
+        }
+        size_t gnss = rtcm3_gnss_find(list, n);
+        if (gnss < RTCM3_GNSS_COUNT)
+        {
+            listed[gnss] = true;
+            found = true;
+        }
+        list += n;
+        if (list < end)
+        {
+            list++;  // the separator
+        }
+    }
+
+    // drop MSMs, ephemerides and biases of every GNSS that is not listed
+    for (size_t i = 0; i < RTCM3_GNSS_COUNT; i++)
+    {
+        for (uint16_t type = RTCM3_GNSS[i].msm * 10 + 1; type <= RTCM3_GNSS[i].msm * 10 + 7; type++)
+        {
+            rtcm3_filter_set(filter, type, listed[i]);
+        }
+        for (size_t j = 0; j < sizeof(RTCM3_GNSS[i].others) / sizeof(RTCM3_GNSS[i].others[0]) && RTCM3_GNSS[i].others[j] != 0; j++)
+        {
+            rtcm3_filter_set(filter, RTCM3_GNSS[i].others[j], listed[i]);
+        }
+    }
+
+    return found;
+}
+
+bool rtcm3_filter_match(const rtcm3_filter_t* filter, const uint8_t* frame)
+{
+    size_t slot = rtcm3_type_slot(rtcm3_msg_type(frame));
+    return filter->bits[slot / 32] & (1u << (slot % 32));
+}
@@ -0,0 +1,71 @@
+#ifndef ESP32S3_GNSS_RTCM3_H
+#define ESP32S3_GNSS_RTCM3_H
+
+#include <esp_err.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define RTCM3_PREAMBLE        0xD3
+#define RTCM3_HEADER_LEN      3
+#define RTCM3_CRC_LEN         3
+#define RTCM3_PAYLOAD_LEN_MAX 1023
+#define RTCM3_FRAME_LEN_MAX   (RTCM3_HEADER_LEN + RTCM3_PAYLOAD_LEN_MAX + RTCM3_CRC_LEN)
+
+// called with a frame that failed its CRC, for per-type accounting
+typedef void (*rtcm3_crc_error_t)(const uint8_t* frame, size_t len);
+
+// streaming framer, bytes are appended at tail, frames are taken from head
+typedef struct
+{
+    uint8_t* buffer;
+    size_t size;
+    size_t head;
+    size_t tail;
+    uint32_t frames;              // number of valid frames
+    uint32_t crc_errors;          // number of frames with bad CRC
+    uint32_t skipped;             // number of bytes dropped while searching for a preamble
+    rtcm3_crc_error_t crc_error;  // optional, called on each CRC mismatch
+} rtcm3_framer_t;
+
+esp_err_t rtcm3_framer_init(rtcm3_framer_t* framer, size_t size);
+void rtcm3_framer_deinit(rtcm3_framer_t* framer);
+void rtcm3_framer_reset(rtcm3_framer_t* framer);
+uint8_t* rtcm3_framer_space(rtcm3_framer_t* framer, size_t* len);
+void rtcm3_framer_commit(rtcm3_framer_t* framer, size_t len);
+bool rtcm3_framer_next(rtcm3_framer_t* framer, const uint8_t** frame, size_t* len);
+
+// standard messages 1000..1299 and proprietary 4000..4095 have their own slot, the rest share the last one
+#define RTCM3_TYPE_STD_FIRST  1000
+#define RTCM3_TYPE_STD_COUNT  300
+#define RTCM3_TYPE_PROP_FIRST 4000
+#define RTCM3_TYPE_PROP_COUNT 96
+#define RTCM3_TYPE_SLOTS      (RTCM3_TYPE_STD_COUNT + RTCM3_TYPE_PROP_COUNT + 1)
+
+// set of message types, one bit per slot
+typedef struct
+{
+    uint32_t bits[(RTCM3_TYPE_SLOTS + 31) / 32];
+} rtcm3_filter_t;
+
+// bit positions count from the start of the frame, the payload starts at bit 24
+uint32_t rtcm3_getbitu(const uint8_t* buff, int pos, int len);
+uint16_t rtcm3_msg_type(const uint8_t* frame);
+bool rtcm3_is_msm(uint16_t type);
+uint32_t rtcm3_msm_epoch(const uint8_t* frame);
+bool rtcm3_msm_multiple(const uint8_t* frame);
+
+size_t rtcm3_type_slot(uint16_t type);
+uint16_t rtcm3_slot_type(size_t slot);
+
+void rtcm3_filter_fill(rtcm3_filter_t* filter, bool all);
+void rtcm3_filter_set(rtcm3_filter_t* filter, uint16_t type, bool allow);
+void rtcm3_filter_intersect(rtcm3_filter_t* filter, const rtcm3_filter_t* other);
+bool rtcm3_filter_match(const rtcm3_filter_t* filter, const uint8_t* frame);
+
+// GNSS names in a list such as "GPS-GAL" or "GPS+GAL", RTCM3_GNSS_COUNT for an unknown name
+#define RTCM3_GNSS_COUNT 7
+size_t rtcm3_gnss_find(const char* name, size_t len);
+bool rtcm3_filter_gnss(rtcm3_filter_t* filter, const char* list, size_t len, const char* separators);
+
+#endif  // ESP32S3_GNSS_RTCM3_H
@@ -0,0 +1,188 @@
+#include "rtcm3_msm.h"
+
+#include <esp_timer.h>
+#include <string.h>
+
+#include "rtcm3.h"
+#include "util.h"
+
+static const char* TAG = "RTCM3_MSM";
+
+// bit positions from the start of the frame
+#define MSM_SAT_MASK_POS  (24 + 73)
+#define MSM_SIG_MASK_POS  (MSM_SAT_MASK_POS + 64)
+#define MSM_CELL_MASK_POS (MSM_SIG_MASK_POS + 32)
+
+// field sizes by MSM number, DF397..DF408 in RTCM 10403.3 table 3.5-78..81
+typedef struct
+{
+    uint8_t sat_bits;  // satellite data per satellite
+    uint8_t pre_bits;  // signal data per cell that comes before CNR
+    uint8_t cnr_bits;  // 0 when there is no CNR
+} msm_fields_t;
+
+static const msm_fields_t MSM_FIELDS[8] = {
+    {0, 0, 0},                    // not an MSM
+    {10, 15, 0},                  // MSM1: pseudorange
+    {10, 22 + 4 + 1, 0},          // MSM2: phaserange, lock time, half-cycle
+    {10, 15 + 22 + 4 + 1, 0},     // MSM3: MSM1 + MSM2
+    {18, 15 + 22 + 4 + 1, 6},     // MSM4: MSM3 + CNR
+    {36, 15 + 22 + 4 + 1, 6},     // MSM5: MSM4 + phaserange rate, which comes after CNR
+    {18, 20 + 24 + 10 + 1, 10},   // MSM6: high resolution MSM4
+    {36, 20 + 24 + 10 + 1, 10},   // MSM7: high resolution MSM5
+};
+
+static uint64_t rtcm3_getbitu64(const uint8_t* buff, int pos, int len)
+{
+    // the masks are wider than rtcm3_getbitu can read at once
+    if (len <= 32)
+    {
+        return rtcm3_getbitu(buff, pos, len);
+    }
+    return ((uint64_t)rtcm3_getbitu(buff, pos, len - 32) << 32) | rtcm3_getbitu(buff, pos + len - 32, 32);
+}
+
+static bool rtcm3_msm_layout(rtcm3_msm_decoder_t* decoder, rtcm3_msm_layout_t* layout, const uint8_t* frame, size_t bits)
+{
+    uint64_t sat_mask = rtcm3_getbitu64(frame, MSM_SAT_MASK_POS, 64);
+    uint32_t sig_mask = rtcm3_getbitu(frame, MSM_SIG_MASK_POS, 32);
+    int num_sat = __builtin_popcountll(sat_mask);
+    int num_sig = __builtin_popcount(sig_mask);
+
+    if (num_sat * num_sig > RTCM3_MSM_CELL_MAX || MSM_CELL_MASK_POS + num_sat * num_sig > bits)
+    {
+        return false;
+    }
+
+    uint64_t cell_mask = rtcm3_getbitu64(frame, MSM_CELL_MASK_POS, num_sat * num_sig);
+
+    // the same satellites and signals as last epoch, nothing to rebuild
+    if (sat_mask == layout->sat_mask && sig_mask == layout->sig_mask && cell_mask == layout->cell_mask && layout->num_sat > 0)
+    {
+        return true;
+    }
+
+    decoder->layout_changes++;
+    layout->sat_mask = sat_mask;
+    layout->sig_mask = sig_mask;
+    layout->cell_mask = cell_mask;
+    layout->num_sat = num_sat;
+    layout->num_sig = num_sig;
+    layout->num_cell = 0;
+
+    // satellite ids are mask positions, the first bit is satellite 1
+    uint8_t sat = 0;
+    for (int bit = 0; bit < 64; bit++)
+    {
+        if (sat_mask & (1ULL << (63 - bit)))
+        {
+            layout->sat_id[sat++] = bit + 1;
+        }
+    }
+
+    // cells are ordered by satellite, then by signal, the first cell is the top bit
+    for (int cell = 0; cell < num_sat * num_sig; cell++)
+    {
+        if (cell_mask & (1ULL << (num_sat * num_sig - 1 - cell)))
+        {
+            layout->cell_sat[layout->num_cell++] = cell / num_sig;
+        }
+    }
+
+    return true;
+}
+
+void rtcm3_msm_reset(rtcm3_msm_decoder_t* decoder)
+{
+    memset(decoder, 0, sizeof(rtcm3_msm_decoder_t));
+}
+
+bool rtcm3_msm_decode(rtcm3_msm_decoder_t* decoder, const uint8_t* frame, size_t len)
+{
+    uint16_t type = rtcm3_msg_type(frame);
+    if (!rtcm3_is_msm(type))
+    {
+        return false;
+    }
+
+    size_t bits = (len - RTCM3_CRC_LEN) * 8;
+    uint8_t gnss = (type - 1071) / 10;
+    const msm_fields_t* fields = &MSM_FIELDS[type % 10];
+    rtcm3_msm_layout_t* layout = &decoder->layout[gnss];
+    status_sky_t* sky = &decoder->sky;
+
+    // the previous epoch has been handed out, keep only the count
+    if (decoder->complete)
+    {
+        uint32_t epochs = sky->epochs;
+        memset(sky, 0, sizeof(status_sky_t));
+        sky->epochs = epochs;
+        decoder->cnr_sum = 0;
+        decoder->cnr_count = 0;
+        decoder->complete = false;
+    }
+
+    if (!rtcm3_msm_layout(decoder, layout, frame, bits))
+    {
+        ESP_LOGD(TAG, "Bad MSM %u, len=%d", type, len);
+        decoder->errors++;
+        memset(layout, 0, sizeof(rtcm3_msm_layout_t));
+        return false;
+    }
+
+    // CNR of every cell is one block after the satellite data and the signal fields before it
+    size_t cnr_pos = MSM_CELL_MASK_POS + layout->num_sat * layout->num_sig + layout->num_sat * fields->sat_bits + layout->num_cell * fields->pre_bits;
+    if (cnr_pos + layout->num_cell * fields->cnr_bits > bits)
+    {
+        decoder->errors++;
+        return false;
+    }
+
+    // append the satellites of this constellation to the epoch, the ones that do not fit are left out
+    uint8_t first = sky->num_sat;
+    for (uint8_t i = 0; i < layout->num_sat && sky->num_sat < STATUS_SKY_SAT_MAX; i++)
+    {
+        status_sat_t* sat = &sky->sats[sky->num_sat++];
+        sat->gnss = gnss;
+        sat->id = layout->sat_id[i];
+        sat->signals = 0;
+        sat->cnr = 0;
+    }
+
+    for (uint8_t cell = 0; cell < layout->num_cell; cell++)
+    {
+        uint16_t cnr = 0;
+        if (fields->cnr_bits > 0)
+        {
+            // MSM4/5 count whole dBHz, MSM6/7 1/16 dBHz
+            cnr = rtcm3_getbitu(frame, cnr_pos + cell * fields->cnr_bits, fields->cnr_bits);
+            cnr = fields->cnr_bits == 6 ? cnr << 4 : cnr;
+        }
+
+        if (cnr > 0)
+        {
+            decoder->cnr_sum += cnr;
+            decoder->cnr_count++;
+        }
+
+        sky->num_signals++;
+        if (first + layout->cell_sat[cell] < sky->num_sat)
+        {
+            status_sat_t* sat = &sky->sats[first + layout->cell_sat[cell]];
+            sat->signals++;
+            sat->cnr = MAX(sat->cnr, cnr);
+        }
+    }
+
+    if (rtcm3_msm_multiple(frame))
+    {
+        return false;
+    }
+
+    // last MSM of the epoch, the summary stays valid until the next frame
+    decoder->complete = true;
+    sky->updated = esp_timer_get_time();
+    sky->epochs++;
+    sky->cnr_avg = decoder->cnr_count > 0 ? decoder->cnr_sum / decoder->cnr_count : 0;
+    return true;
+}
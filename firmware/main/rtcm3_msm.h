@@ -0,0 +1,40 @@
+#ifndef ESP32S3_GNSS_RTCM3_MSM_H
+#define ESP32S3_GNSS_RTCM3_MSM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "status.h"
+
+#define RTCM3_MSM_CELL_MAX 64  // satellites x signals allowed in one message
+
+// layout of the last MSM of one constellation, only rebuilt when its masks change
+typedef struct
+{
+    uint64_t sat_mask;
+    uint32_t sig_mask;
+    uint64_t cell_mask;
+    uint8_t num_sat;
+    uint8_t num_sig;
+    uint8_t num_cell;
+    uint8_t sat_id[RTCM3_MSM_CELL_MAX];    // 1-based satellite id of each satellite index
+    uint8_t cell_sat[RTCM3_MSM_CELL_MAX];  // satellite index of each cell
+} rtcm3_msm_layout_t;
+
+// streaming decoder, frames of one epoch are summed until the multiple message bit is cleared
+typedef struct
+{
+    rtcm3_msm_layout_t layout[STATUS_SKY_GNSS_MAX];  // indexed by constellation
+    status_sky_t sky;                                // epoch being assembled
+    uint32_t cnr_sum;                                // 1/16 dBHz, signals of the epoch being assembled
+    uint16_t cnr_count;                              // signals that carried CNR
+    bool complete;                                   // sky holds a finished epoch
+    uint32_t layout_changes;                         // masks that differed from the previous epoch
+    uint32_t errors;                                 // MSMs shorter than their masks
+} rtcm3_msm_decoder_t;
+
+void rtcm3_msm_reset(rtcm3_msm_decoder_t* decoder);
+bool rtcm3_msm_decode(rtcm3_msm_decoder_t* decoder, const uint8_t* frame, size_t len);
+
+#endif  // ESP32S3_GNSS_RTCM3_MSM_H
@@ -0,0 +1,207 @@
+#include "rtcm3_pool.h"
+
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <string.h>
+
+#include "latency.h"
+#include "util.h"
+
+static const char* TAG = "RTCM3_POOL";
+
+static rtcm3_buffer_t buffers[RTCM3_POOL_BUFFERS];
+static rtcm3_buffer_t* free_list[RTCM3_POOL_BUFFERS];
+static size_t free_count = 0;
+static uint32_t used_max = 0;
+static uint32_t exhausted = 0;
+
+static rtcm3_consumer_t consumers[RTCM3_POOL_CONSUMERS];
+
+static QueueHandle_t dispatch_queue = NULL;
+static uint32_t dispatched = 0;
+static uint32_t dispatch_dropped = 0;
+static uint32_t dispatch_depth_max = 0;
+static uint32_t dispatch_latency_max = 0;  // us
+static uint64_t dispatch_latency_sum = 0;  // us
+
+static portMUX_TYPE pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+rtcm3_buffer_t* rtcm3_pool_acquire()
+{
+    rtcm3_buffer_t* buffer = NULL;
+
+    portENTER_CRITICAL(&pool_lock);
+    if (free_count > 0)
+    {
+        buffer = free_list[--free_count];
+        used_max = MAX(used_max, RTCM3_POOL_BUFFERS - free_count);
+    }
+    else
+    {
+        exhausted++;
+    }
+    portEXIT_CRITICAL(&pool_lock);
+
+    if (buffer != NULL)
+    {
+        buffer->len = 0;
+        buffer->received = 0;
+        atomic_store(&buffer->refs, 1);
+    }
+    return buffer;
+}
+
+void rtcm3_buffer_ref(rtcm3_buffer_t* buffer)
+{
+    atomic_fetch_add(&buffer->refs, 1);
+}
+
+void rtcm3_buffer_release(rtcm3_buffer_t* buffer)
+{
+    if (atomic_fetch_sub(&buffer->refs, 1) != 1)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&pool_lock);
+    free_list[free_count++] = buffer;
+    portEXIT_CRITICAL(&pool_lock);
+}
+
+esp_err_t rtcm3_pool_register_consumer(rtcm3_consumer_t consumer)
+{
+    esp_err_t err = ESP_ERR_NO_MEM;
+
+    portENTER_CRITICAL(&pool_lock);
+    for (size_t i = 0; i < RTCM3_POOL_CONSUMERS; i++)
+    {
+        if (consumers[i] == NULL)
+        {
+            consumers[i] = consumer;
+            err = ESP_OK;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&pool_lock);
+
+    ERROR_IF(err != ESP_OK, return err, "Too many RTCM3 consumers");
+    return ESP_OK;
+}
+
+void rtcm3_pool_unregister_consumer(rtcm3_consumer_t consumer)
+{
+    portENTER_CRITICAL(&pool_lock);
+    for (size_t i = 0; i < RTCM3_POOL_CONSUMERS; i++)
+    {
+        if (consumers[i] == consumer)
+        {
+            consumers[i] = NULL;
+        }
+    }
+    portEXIT_CRITICAL(&pool_lock);
+}
+
+void rtcm3_pool_publish(rtcm3_buffer_t* buffer)
+{
+    // the publisher's reference moves to the queue
+    buffer->published = esp_timer_get_time();
+    if (xQueueSend(dispatch_queue, &buffer, 0) != pdTRUE)
+    {
+        dispatch_dropped++;
+        rtcm3_buffer_release(buffer);
+        return;
+    }
+
+    dispatch_depth_max = MAX(dispatch_depth_max, uxQueueMessagesWaiting(dispatch_queue));
+}
+
+static void rtcm3_dispatch_task(void* ctx)
+{
+    rtcm3_consumer_t list[RTCM3_POOL_CONSUMERS];
+    rtcm3_buffer_t* buffer;
+    uint32_t latency;
+
+    ESP_LOGI(TAG, "Start rtcm3_dispatch_task");
+    while (true)
+    {
+        if (xQueueReceive(dispatch_queue, &buffer, pdMS_TO_TICKS(RTCM3_DISPATCH_IDLE_MS)) != pdTRUE)
+        {
+            buffer = NULL;
+        }
+        else
+        {
+            latency = (uint32_t)(esp_timer_get_time() - buffer->published);
+            dispatch_latency_max = MAX(dispatch_latency_max, latency);
+            dispatch_latency_sum += latency;
+            dispatched++;
+            latency_record(LATENCY_DISPATCH, buffer->received);
+        }
+
+        portENTER_CRITICAL(&pool_lock);
+        memcpy(list, consumers, sizeof(consumers));
+        portEXIT_CRITICAL(&pool_lock);
+
+        for (size_t i = 0; i < RTCM3_POOL_CONSUMERS; i++)
+        {
+            if (list[i] != NULL)
+            {
+                list[i](buffer);
+            }
+        }
+
+        // drop the queue's reference
+        if (buffer != NULL)
+        {
+            rtcm3_buffer_release(buffer);
+        }
+    }
+}
+
+esp_err_t rtcm3_pool_init()
+{
+    // one allocation for the whole life of the device, nothing is freed back to the heap
+    uint8_t* data = heap_caps_calloc(RTCM3_POOL_BUFFERS, RTCM3_FRAME_LEN_MAX, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    ERROR_IF(data == NULL, return ESP_ERR_NO_MEM, "Cannot allocate RTCM3 pool");
+
+    for (size_t i = 0; i < RTCM3_POOL_BUFFERS; i++)
+    {
+        buffers[i].data = data + i * RTCM3_FRAME_LEN_MAX;
+        buffers[i].len = 0;
+        atomic_init(&buffers[i].refs, 0);
+        free_list[i] = &buffers[i];
+    }
+    free_count = RTCM3_POOL_BUFFERS;
+
+    // every buffer can be in flight at once, so the queue never blocks the publisher
+    dispatch_queue = xQueueCreate(RTCM3_POOL_BUFFERS, sizeof(rtcm3_buffer_t*));
+    ERROR_IF(dispatch_queue == NULL, return ESP_ERR_NO_MEM, "Cannot create RTCM3 dispatch queue");
+
+    BaseType_t ret = xTaskCreatePinnedToCore(rtcm3_dispatch_task, "rtcm3_dispatch", RTCM3_DISPATCH_STACK, NULL, RTCM3_DISPATCH_PRIORITY, NULL, RTCM3_DISPATCH_CORE);
+    ERROR_IF(ret != pdPASS, return ESP_FAIL, "Cannot start RTCM3 dispatch task");
+
+    ESP_LOGI(TAG, "RTCM3 pool: %d buffers of %d bytes", RTCM3_POOL_BUFFERS, RTCM3_FRAME_LEN_MAX);
+    return ESP_OK;
+}
+
+size_t rtcm3_pool_stats_print(char* buffer, size_t len)
+{
+    int n = snprintf(buffer,
+                     len,
+                     "pool_buffers=%d" NEWLINE "pool_free=%d" NEWLINE "pool_used_max=%lu" NEWLINE "pool_exhausted=%lu" NEWLINE "dispatch_depth=%d" NEWLINE
+                     "dispatch_depth_max=%lu" NEWLINE "dispatched=%lu" NEWLINE "dispatch_dropped=%lu" NEWLINE "dispatch_latency_avg_us=%llu" NEWLINE
+                     "dispatch_latency_max_us=%lu" NEWLINE,
+                     RTCM3_POOL_BUFFERS,
+                     free_count,
+                     used_max,
+                     exhausted,
+                     uxQueueMessagesWaiting(dispatch_queue),
+                     dispatch_depth_max,
+                     dispatched,
+                     dispatch_dropped,
+                     dispatched > 0 ? dispatch_latency_sum / dispatched : 0,
+                     dispatch_latency_max);
+    return n < 0 ? 0 : MIN((size_t)n, len - 1);
+}
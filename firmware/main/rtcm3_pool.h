@@ -0,0 +1,45 @@
+#ifndef ESP32S3_GNSS_RTCM3_POOL_H
+#define ESP32S3_GNSS_RTCM3_POOL_H
+
+#include <esp_err.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rtcm3.h"
+
+#define RTCM3_POOL_BUFFERS   64
+#define RTCM3_POOL_CONSUMERS 4
+
+// the dispatcher runs away from the WiFi/lwIP core, above the reader tasks
+#define RTCM3_DISPATCH_STACK    4096
+#define RTCM3_DISPATCH_PRIORITY 12
+#define RTCM3_DISPATCH_CORE     1
+#define RTCM3_DISPATCH_IDLE_MS  20
+
+// a frame buffer shared by all consumers, returned to the pool on the last release
+typedef struct
+{
+    uint8_t* data;  // RTCM3_FRAME_LEN_MAX bytes in PSRAM
+    size_t len;
+    int64_t received;   // esp_timer time when the bytes were read from the UART
+    int64_t published;  // esp_timer time when queued for dispatch
+    atomic_uint refs;
+} rtcm3_buffer_t;
+
+// consumers run in the dispatcher task, take a reference to keep the buffer longer;
+// buffer is NULL when nothing arrived for RTCM3_DISPATCH_IDLE_MS, so held data can be flushed
+typedef void (*rtcm3_consumer_t)(rtcm3_buffer_t* buffer);
+
+esp_err_t rtcm3_pool_init();
+rtcm3_buffer_t* rtcm3_pool_acquire();
+void rtcm3_buffer_ref(rtcm3_buffer_t* buffer);
+void rtcm3_buffer_release(rtcm3_buffer_t* buffer);
+
+esp_err_t rtcm3_pool_register_consumer(rtcm3_consumer_t consumer);
+void rtcm3_pool_unregister_consumer(rtcm3_consumer_t consumer);
+void rtcm3_pool_publish(rtcm3_buffer_t* buffer);
+
+size_t rtcm3_pool_stats_print(char* buffer, size_t len);
+
+#endif  // ESP32S3_GNSS_RTCM3_POOL_H
@@ -0,0 +1,75 @@
+#include "rtcm3_stats.h"
+
+#include <esp_timer.h>
+#include <stdio.h>
+
+#include "rtcm3.h"
+#include "util.h"
+
+// indexed by rtcm3_type_slot
+static rtcm3_type_stats_t stats[RTCM3_TYPE_SLOTS] = {0};
+
+void rtcm3_stats_frame(const uint8_t* frame, size_t len)
+{
+    int64_t now = esp_timer_get_time();
+    rtcm3_type_stats_t* entry = &stats[rtcm3_type_slot(rtcm3_msg_type(frame))];
+
+    // 1/8 smoothing, the first interval seeds the average
+    if (entry->frames > 1)
+    {
+        int64_t period = now - entry->last_seen;
+        entry->period_us = (int64_t)entry->period_us + (period - (int64_t)entry->period_us) / 8;
+    }
+    else if (entry->frames == 1)
+    {
+        entry->period_us = now - entry->last_seen;
+    }
+
+    entry->frames++;
+    entry->bytes += len;
+    entry->last_seen = now;
+}
+
+void rtcm3_stats_crc_error(const uint8_t* frame, size_t len)
+{
+    // the type of a corrupted frame is a best guess
+    if (len >= RTCM3_HEADER_LEN + 2 + RTCM3_CRC_LEN)
+    {
+        stats[rtcm3_type_slot(rtcm3_msg_type(frame))].crc_errors++;
+    }
+}
+
+size_t rtcm3_stats_print(char* buffer, size_t len)
+{
+    int64_t now = esp_timer_get_time();
+    size_t pos = 0;
+    int n;
+
+    // one line per type seen so far, type 0 collects everything else
+    for (size_t slot = 0; slot < RTCM3_TYPE_SLOTS; slot++)
+    {
+        const rtcm3_type_stats_t* entry = &stats[slot];
+        if (entry->frames == 0 && entry->crc_errors == 0)
+        {
+            continue;
+        }
+
+        n = snprintf(buffer + pos,
+                     len - pos,
+                     "%u=frames:%lu,bytes:%lu,rate_mhz:%lu,age_ms:%lld,crc_errors:%lu" NEWLINE,
+                     rtcm3_slot_type(slot),
+                     entry->frames,
+                     entry->bytes,
+                     entry->period_us > 0 ? (uint32_t)(1000000000ULL / entry->period_us) : 0,
+                     entry->frames > 0 ? (now - entry->last_seen) / 1000 : -1LL,
+                     entry->crc_errors);
+        if (n < 0 || (size_t)n >= len - pos)
+        {
+            break;
+        }
+        pos += n;
+    }
+
+    buffer[pos] = '\0';
+    return pos;
+}
@@ -0,0 +1,20 @@
+#ifndef ESP32S3_GNSS_RTCM3_STATS_H
+#define ESP32S3_GNSS_RTCM3_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t crc_errors;
+    uint32_t period_us;  // smoothed time between two frames
+    int64_t last_seen;   // us, esp_timer time
+} rtcm3_type_stats_t;
+
+void rtcm3_stats_frame(const uint8_t* frame, size_t len);
+void rtcm3_stats_crc_error(const uint8_t* frame, size_t len);
+size_t rtcm3_stats_print(char* buffer, size_t len);
+
+#endif  // ESP32S3_GNSS_RTCM3_STATS_H
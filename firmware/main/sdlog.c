@@ -0,0 +1,386 @@
+#include "sdlog.h"
+
+#include <dirent.h>
+#include <driver/gpio.h>
+#include <driver/sdspi_host.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <esp_vfs_fat.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <sdmmc_cmd.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "rtcm3.h"
+#include "rtcm3_pool.h"
+#include "util.h"
+
+#define SDLOG_MOUNT             "/sdcard"
+#define SDLOG_MAX_FILES         4
+#define SDLOG_ALLOCATION_UNIT   (16 * 1024)
+#define SDLOG_ROTATE_KB_DEFAULT 16384  // 16 MB
+#define SDLOG_ROTATE_S_DEFAULT  3600
+#define SDLOG_SYNC_MS_DEFAULT   900  // every epoch at 1 Hz, with room for jitter
+#define SDLOG_TASK_STACK        4096
+#define SDLOG_TASK_PRIORITY     3  // below the UART readers, the RTCM3 dispatcher and the caster
+#define SDLOG_NAME_LEN          32
+
+// the card is wired for 4-bit SD, SPI mode uses CLK, CMD as MOSI, DAT0 as MISO and DAT3 as CS
+#define SDLOG_PIN_CLK  GPIO_NUM_7
+#define SDLOG_PIN_MOSI GPIO_NUM_15
+#define SDLOG_PIN_MISO GPIO_NUM_6
+#define SDLOG_PIN_CS   GPIO_NUM_16
+
+static const char* TAG = "SDLOG";
+
+// 8.3 names, long file names are off in the FAT configuration
+static const struct
+{
+    const char* name;
+    const char* prefix;
+    const char* ext;
+} SDLOG_FILES[SDLOG_MAX] = {
+    {"rtcm3", "RT", "RTM"},  //
+    {"ubx", "UB", "UBX"},    //
+    {"rawx", "RX", "UBX"},   //
+};
+
+typedef struct
+{
+    uint8_t* data;
+    size_t len;
+    bool sync;  // flush to the card once written
+} sdlog_buffer_t;
+
+typedef struct
+{
+    sdlog_stream_t stream;
+    sdlog_buffer_t* buffer;
+} sdlog_job_t;
+
+// each stream has a single producer task, it fills a buffer without a lock and hands it over to the writer
+static struct
+{
+    sdlog_buffer_t buffers[SDLOG_BUFFERS];
+    sdlog_buffer_t* fill;  // owned by the producer, NULL until a free buffer is needed
+    QueueHandle_t free;    // empty buffers returned by the writer
+    int64_t synced;        // us, when the last partial buffer was handed over
+    FILE* file;            // owned by the writer
+    uint32_t index;        // number in the name of the last file
+    size_t file_bytes;
+    int64_t file_opened;  // us
+    struct
+    {
+        uint32_t bytes;         // given by the producer
+        uint32_t written;       // on the card
+        uint32_t dropped;       // no free buffer, counted by the producer
+        uint32_t lost;          // failed writes, counted by the writer; each side owns its counter
+        uint32_t syncs;         // partial buffers flushed on an epoch
+        uint32_t files;         // opened since boot
+        uint32_t write_errors;  // failed opens, writes and syncs
+        uint32_t write_us_max;  // longest write of a buffer, sync included
+    } stats;
+} streams[SDLOG_MAX];
+
+static sdmmc_card_t* sdlog_card = NULL;
+static QueueHandle_t sdlog_queue = NULL;  // full buffers of all streams, in hand over order
+static bool sdlog_enabled = false;
+static size_t sdlog_rotate_bytes = 0;  // 0 keeps a file until the next policy
+static int64_t sdlog_rotate_us = 0;
+static int64_t sdlog_sync_us = 0;  // 0 only writes full buffers
+
+static void sdlog_hand_over(sdlog_stream_t stream, bool sync)
+{
+    sdlog_job_t job = {stream, streams[stream].fill};
+
+    // the queue holds every buffer of every stream, so this never waits
+    job.buffer->sync = sync;
+    xQueueSend(sdlog_queue, &job, 0);
+    streams[stream].fill = NULL;
+}
+
+void sdlog_write(sdlog_stream_t stream, const uint8_t* data, size_t len)
+{
+    if (!sdlog_enabled)
+    {
+        return;
+    }
+
+    streams[stream].stats.bytes += len;
+
+    // messages are never split, so every file starts on a message
+    if (streams[stream].fill != NULL && streams[stream].fill->len + len > SDLOG_BUFFER_LEN)
+    {
+        sdlog_hand_over(stream, false);
+    }
+
+    // a slow card never blocks the reader, the bytes are counted instead
+    if (len > SDLOG_BUFFER_LEN || (streams[stream].fill == NULL && xQueueReceive(streams[stream].free, &streams[stream].fill, 0) != pdTRUE))
+    {
+        streams[stream].stats.dropped += len;
+        return;
+    }
+
+    memcpy(streams[stream].fill->data + streams[stream].fill->len, data, len);
+    streams[stream].fill->len += len;
+}
+
+void sdlog_epoch(sdlog_stream_t stream)
+{
+    int64_t now = esp_timer_get_time();
+
+    // a complete epoch reaches the card at most every sync interval, partial buffers cost free ones
+    if (!sdlog_enabled || sdlog_sync_us == 0 || streams[stream].fill == NULL || now - streams[stream].synced < sdlog_sync_us)
+    {
+        return;
+    }
+
+    streams[stream].synced = now;
+    sdlog_hand_over(stream, true);
+}
+
+static void sdlog_rtcm3_consumer(rtcm3_buffer_t* buffer)
+{
+    if (buffer == NULL)
+    {
+        return;
+    }
+
+    sdlog_write(SDLOG_RTCM3, buffer->data, buffer->len);
+
+    // the last MSM of the epoch clears the multiple message bit
+    if (buffer->len > RTCM3_HEADER_LEN + RTCM3_CRC_LEN && buffer->data[0] == RTCM3_PREAMBLE && rtcm3_is_msm(rtcm3_msg_type(buffer->data)) &&
+        !rtcm3_msm_multiple(buffer->data))
+    {
+        sdlog_epoch(SDLOG_RTCM3);
+    }
+}
+
+// highest number in the names of a stream, so a restart never overwrites a log
+static uint32_t sdlog_last_index(sdlog_stream_t stream)
+{
+    uint32_t last = 0;
+    struct dirent* entry;
+
+    DIR* dir = opendir(SDLOG_MOUNT);
+    if (dir == NULL)
+    {
+        return 0;
+    }
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        const char* ext = strrchr(entry->d_name, '.');
+        if (ext != NULL && strncasecmp(entry->d_name, SDLOG_FILES[stream].prefix, 2) == 0 && strcasecmp(ext + 1, SDLOG_FILES[stream].ext) == 0)
+        {
+            last = MAX(last, (uint32_t)strtoul(entry->d_name + 2, NULL, 10));
+        }
+    }
+
+    closedir(dir);
+    return last;
+}
+
+static void sdlog_open(sdlog_stream_t stream, int64_t now)
+{
+    char name[SDLOG_NAME_LEN];
+
+    snprintf(name, sizeof(name), SDLOG_MOUNT "/%s%06lu.%s", SDLOG_FILES[stream].prefix, streams[stream].index + 1, SDLOG_FILES[stream].ext);
+    streams[stream].file = fopen(name, "wb");
+    if (streams[stream].file == NULL)
+    {
+        streams[stream].stats.write_errors++;
+        ERROR("Cannot open %s", name);
+        return;
+    }
+
+    // whole buffers go straight to FAT, without another copy in stdio
+    setvbuf(streams[stream].file, NULL, _IONBF, 0);
+    streams[stream].index++;
+    streams[stream].file_bytes = 0;
+    streams[stream].file_opened = now;
+    streams[stream].stats.files++;
+    ESP_LOGI(TAG, "Logging %s to %s", SDLOG_FILES[stream].name, name);
+}
+
+static void sdlog_rotate(sdlog_stream_t stream, int64_t now)
+{
+    FILE* file = streams[stream].file;
+
+    if (file != NULL && ((sdlog_rotate_bytes > 0 && streams[stream].file_bytes >= sdlog_rotate_bytes) ||
+                         (sdlog_rotate_us > 0 && now - streams[stream].file_opened >= sdlog_rotate_us)))
+    {
+        fclose(file);
+        streams[stream].file = NULL;
+    }
+
+    if (streams[stream].file == NULL)
+    {
+        sdlog_open(stream, now);
+    }
+}
+
+static void sdlog_task(void* ctx)
+{
+    sdlog_job_t job;
+
+    while (true)
+    {
+        if (xQueueReceive(sdlog_queue, &job, portMAX_DELAY) != pdTRUE)
+        {
+            continue;
+        }
+
+        int64_t start = esp_timer_get_time();
+        sdlog_buffer_t* buffer = job.buffer;
+
+        // files only change between buffers, which end on a message
+        sdlog_rotate(job.stream, start);
+
+        size_t written = streams[job.stream].file != NULL ? fwrite(buffer->data, 1, buffer->len, streams[job.stream].file) : 0;
+        bool ok = written == buffer->len;
+        if (ok && buffer->sync)
+        {
+            ok = fsync(fileno(streams[job.stream].file)) == 0;
+            streams[job.stream].stats.syncs++;
+        }
+
+        // a full or removed card, the next buffer tries a new file
+        if (!ok && streams[job.stream].file != NULL)
+        {
+            streams[job.stream].stats.write_errors++;
+            fclose(streams[job.stream].file);
+            streams[job.stream].file = NULL;
+        }
+
+        streams[job.stream].file_bytes += written;
+        streams[job.stream].stats.written += written;
+        streams[job.stream].stats.lost += buffer->len - written;
+        streams[job.stream].stats.write_us_max = MAX(streams[job.stream].stats.write_us_max, (uint32_t)(esp_timer_get_time() - start));
+
+        buffer->len = 0;
+        xQueueSend(streams[job.stream].free, &buffer, 0);
+    }
+}
+
+esp_err_t sdlog_init()
+{
+    esp_err_t err = ESP_OK;
+
+    /*
+     * mount the SD card
+     */
+
+    sdmmc_host_t host = SDSPI_HOST_DEFAULT();
+    spi_bus_config_t bus_config = {
+        .mosi_io_num = SDLOG_PIN_MOSI,
+        .miso_io_num = SDLOG_PIN_MISO,
+        .sclk_io_num = SDLOG_PIN_CLK,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = 4096,
+    };
+    err = spi_bus_initialize(host.slot, &bus_config, SDSPI_DEFAULT_DMA);
+    ERROR_IF(err != ESP_OK, return err, "Cannot start SPI bus for SD card");
+
+    sdspi_device_config_t slot_config = SDSPI_DEVICE_CONFIG_DEFAULT();
+    slot_config.gpio_cs = SDLOG_PIN_CS;
+    slot_config.host_id = host.slot;
+
+    esp_vfs_fat_sdmmc_mount_config_t mount_config = {
+        .format_if_mount_failed = false,
+        .max_files = SDLOG_MAX_FILES,
+        .allocation_unit_size = SDLOG_ALLOCATION_UNIT,
+    };
+    err = esp_vfs_fat_sdspi_mount(SDLOG_MOUNT, &host, &slot_config, &mount_config, &sdlog_card);
+    ERROR_IF(err != ESP_OK, return err, "Cannot mount SD card, logging is off");
+
+    /*
+     * buffers and policies
+     */
+
+    sdlog_queue = xQueueCreate(SDLOG_MAX * SDLOG_BUFFERS, sizeof(sdlog_job_t));
+    ERROR_IF(sdlog_queue == NULL, return ESP_ERR_NO_MEM, "Cannot create SD log queue");
+
+    for (size_t stream = SDLOG_START; stream < SDLOG_MAX; stream++)
+    {
+        uint8_t* data = heap_caps_malloc(SDLOG_BUFFERS * SDLOG_BUFFER_LEN, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        ERROR_IF(data == NULL, return ESP_ERR_NO_MEM, "Cannot allocate SD log buffers");
+        streams[stream].free = xQueueCreate(SDLOG_BUFFERS, sizeof(sdlog_buffer_t*));
+        ERROR_IF(streams[stream].free == NULL, return ESP_ERR_NO_MEM, "Cannot create SD log free queue");
+
+        for (size_t i = 0; i < SDLOG_BUFFERS; i++)
+        {
+            sdlog_buffer_t* buffer = &streams[stream].buffers[i];
+            buffer->data = data + i * SDLOG_BUFFER_LEN;
+            xQueueSend(streams[stream].free, &buffer, 0);
+        }
+
+        streams[stream].index = sdlog_last_index(stream);
+    }
+
+    char* rotate_kb = config_get(CONFIG_LOG_ROTATE_KB);
+    sdlog_rotate_bytes = (strlen(rotate_kb) > 0 ? atoi(rotate_kb) : SDLOG_ROTATE_KB_DEFAULT) * 1024;
+    char* rotate_s = config_get(CONFIG_LOG_ROTATE_S);
+    sdlog_rotate_us = (strlen(rotate_s) > 0 ? atoi(rotate_s) : SDLOG_ROTATE_S_DEFAULT) * 1000000LL;
+    char* sync_ms = config_get(CONFIG_LOG_SYNC_MS);
+    sdlog_sync_us = (strlen(sync_ms) > 0 ? atoi(sync_ms) : SDLOG_SYNC_MS_DEFAULT) * 1000LL;
+    ESP_LOGI(TAG, "Rotate at %u KB or %lld s, sync every %lld ms", sdlog_rotate_bytes / 1024, sdlog_rotate_us / 1000000, sdlog_sync_us / 1000);
+
+    xTaskCreate(sdlog_task, "sdlog", SDLOG_TASK_STACK, NULL, SDLOG_TASK_PRIORITY, NULL);
+
+    err = rtcm3_pool_register_consumer(sdlog_rtcm3_consumer);
+    ERROR_IF(err != ESP_OK, return err, "Cannot subscribe to RTCM3 frames");
+
+    sdlog_enabled = true;
+    return ESP_OK;
+}
+
+size_t sdlog_stats_print(char* buffer, size_t len)
+{
+    uint64_t total_bytes = 0;
+    uint64_t free_bytes = 0;
+    size_t pos = 0;
+    int n;
+
+    if (sdlog_enabled)
+    {
+        esp_vfs_fat_info(SDLOG_MOUNT, &total_bytes, &free_bytes);
+    }
+    n = snprintf(buffer,
+                 len,
+                 "enabled=%d" NEWLINE "card=%s" NEWLINE "total_mb=%llu" NEWLINE "free_mb=%llu" NEWLINE,
+                 sdlog_enabled,
+                 sdlog_card != NULL ? sdlog_card->cid.name : "",
+                 total_bytes / (1024 * 1024),
+                 free_bytes / (1024 * 1024));
+    pos = n < 0 ? 0 : MIN((size_t)n, len - 1);
+
+    // one line per stream
+    for (size_t stream = SDLOG_START; stream < SDLOG_MAX; stream++)
+    {
+        n = snprintf(buffer + pos,
+                     len - pos,
+                     "%s=bytes:%lu,written:%lu,dropped:%lu,syncs:%lu,files:%lu,file:%lu,write_errors:%lu,write_us_max:%lu,free_buffers:%u" NEWLINE,
+                     SDLOG_FILES[stream].name,
+                     streams[stream].stats.bytes,
+                     streams[stream].stats.written,
+                     streams[stream].stats.dropped + streams[stream].stats.lost,
+                     streams[stream].stats.syncs,
+                     streams[stream].stats.files,
+                     streams[stream].index,
+                     streams[stream].stats.write_errors,
+                     streams[stream].stats.write_us_max,
+                     streams[stream].free != NULL ? uxQueueMessagesWaiting(streams[stream].free) : 0);
+        pos = n < 0 ? pos : MIN(pos + n, len - 1);
+    }
+
+    return pos;
+}
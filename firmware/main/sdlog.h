@@ -0,0 +1,26 @@
+#ifndef ESP32S3_GNSS_SDLOG_H
+#define ESP32S3_GNSS_SDLOG_H
+
+#include <esp_err.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SDLOG_BUFFERS    8      // per stream, a stall of the card is absorbed until all are queued
+#define SDLOG_BUFFER_LEN 16384  // bytes in PSRAM, well above one epoch of either stream
+
+// raw streams written to their own rotating files on the SD card
+typedef enum
+{
+    SDLOG_START = 0,
+    SDLOG_RTCM3 = SDLOG_START,  // frames read from UART2
+    SDLOG_UBX,                  // UBX messages read from UART1
+    SDLOG_RAWX,                 // RXM-RAWX and RXM-SFRBX of a raw capture, kept apart for PPP services
+    SDLOG_MAX
+} sdlog_stream_t;
+
+esp_err_t sdlog_init();
+void sdlog_write(sdlog_stream_t stream, const uint8_t* data, size_t len);
+void sdlog_epoch(sdlog_stream_t stream);
+size_t sdlog_stats_print(char* buffer, size_t len);
+
+#endif  // ESP32S3_GNSS_SDLOG_H
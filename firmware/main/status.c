@@ -1,8 +1,13 @@
 #include "status.h"
 
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "config.h"
+#include "nmea.h"
 #include "util.h"
 
 static const char* TAG = "STATUS";
@@ -17,8 +22,20 @@ static char status_name[STATUS_MAX][STATUS_LEN_MAX / 2] = {
     "ntrip_cas_status",  //
     "wifi_status",       //
     "battery",           //
+    "gnss_mode_job",     //
+    "gnss_survey",       //
 };
 
+// typed GNSS state, the GGA/GST texts are only rendered when someone reads them
+static status_gnss_t gnss = {0};
+static bool gnss_dirty[STATUS_GNSS_GST + 1] = {false};
+static portMUX_TYPE gnss_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// RINEX letters in MSM type order
+static const char SKY_GNSS_LETTER[STATUS_SKY_GNSS_MAX] = {'G', 'R', 'E', 'S', 'J', 'C', 'I'};
+static status_sky_t sky = {0};
+static portMUX_TYPE sky_lock = portMUX_INITIALIZER_UNLOCKED;
+
 esp_err_t status_init()
 {
     // clear allocated memory
@@ -29,6 +46,11 @@ esp_err_t status_init()
 
 void status_set(status_t type, const char* value)
 {
+    if (type <= STATUS_GNSS_GST)
+    {
+        gnss_dirty[type] = false;
+    }
+
     memset(status[type], 0, STATUS_LEN_MAX);
     strncpy(status[type], value, STATUS_LEN_MAX);
     ESP_LOGD(TAG, "Status set:\r\nkey=%s\r\nval=%s", status_name[type], status[type]);
@@ -36,6 +58,131 @@ void status_set(status_t type, const char* value)
 
 char* status_get(status_t type)
 {
+    if (type <= STATUS_GNSS_GST && gnss_dirty[type])
+    {
+        status_gnss_t copy;
+        status_gnss_get(&copy);
+        gnss_dirty[type] = false;
+        if (type == STATUS_GNSS_GGA)
+        {
+            nmea_gga_print(&copy, status[type], STATUS_LEN_MAX);
+        }
+        else
+        {
+            nmea_gst_print(&copy, status[type], STATUS_LEN_MAX);
+        }
+    }
+
     ESP_LOGD(TAG, "Status get:\r\nkey=%s\r\nval=%s", status_name[type], status[type]);
     return status[type];
 }
+
+void status_gnss_set(const status_gnss_t* value)
+{
+    portENTER_CRITICAL(&gnss_lock);
+    gnss = *value;
+    gnss_dirty[STATUS_GNSS_GGA] = true;
+    gnss_dirty[STATUS_GNSS_GST] = true;
+    portEXIT_CRITICAL(&gnss_lock);
+}
+
+void status_gnss_get(status_gnss_t* value)
+{
+    portENTER_CRITICAL(&gnss_lock);
+    *value = gnss;
+    portEXIT_CRITICAL(&gnss_lock);
+}
+
+size_t status_gnss_print(char* buffer, size_t len)
+{
+    status_gnss_t copy;
+    status_gnss_get(&copy);
+
+    // decoded values for clients that do not want to parse NMEA
+    int n = snprintf(buffer,
+                     len,
+                     "age_ms=%lld" NEWLINE "utc_ms=%lu" NEWLINE "quality=%u" NEWLINE "num_sv=%u" NEWLINE "dop=%u" NEWLINE "lat_e9=%lld" NEWLINE
+                     "lon_e9=%lld" NEWLINE "hmsl_e4=%ld" NEWLINE "geoid_sep_e4=%ld" NEWLINE "sigma_lat_mm=%lu" NEWLINE "sigma_lon_mm=%lu" NEWLINE
+                     "sigma_alt_mm=%lu" NEWLINE "sat_tracked=%u" NEWLINE "cno_avg=%u" NEWLINE "svin_active=%d" NEWLINE "svin_valid=%d" NEWLINE
+                     "svin_dur=%lu" NEWLINE "svin_acc_e4=%lu" NEWLINE "svin_obs=%lu" NEWLINE "svin_x_e4=%lld" NEWLINE "svin_y_e4=%lld" NEWLINE
+                     "svin_z_e4=%lld" NEWLINE,
+                     copy.updated > 0 ? (esp_timer_get_time() - copy.updated) / 1000 : -1LL,
+                     copy.utc_ms,
+                     copy.quality,
+                     copy.num_sv,
+                     copy.dop,
+                     copy.lat,
+                     copy.lon,
+                     copy.hmsl,
+                     copy.geoid_sep,
+                     copy.sigma_lat,
+                     copy.sigma_lon,
+                     copy.sigma_alt,
+                     copy.sat_tracked,
+                     copy.cno_avg,
+                     copy.svin_active,
+                     copy.svin_valid,
+                     copy.svin_dur,
+                     copy.svin_acc,
+                     copy.svin_obs,
+                     copy.svin_x,
+                     copy.svin_y,
+                     copy.svin_z);
+    return n < 0 ? 0 : MIN((size_t)n, len - 1);
+}
+
+void status_sky_set(const status_sky_t* value)
+{
+    portENTER_CRITICAL(&sky_lock);
+    sky = *value;
+    portEXIT_CRITICAL(&sky_lock);
+}
+
+void status_sky_get(status_sky_t* value)
+{
+    portENTER_CRITICAL(&sky_lock);
+    *value = sky;
+    portEXIT_CRITICAL(&sky_lock);
+}
+
+size_t status_sky_print(char* buffer, size_t len)
+{
+    status_sky_t* copy = malloc(sizeof(status_sky_t));
+    if (copy == NULL)
+    {
+        return 0;
+    }
+    status_sky_get(copy);
+
+    int n = snprintf(buffer,
+                     len,
+                     "age_ms=%lld" NEWLINE "epochs=%lu" NEWLINE "num_sat=%u" NEWLINE "num_signals=%u" NEWLINE "cnr_avg_e1=%u" NEWLINE,
+                     copy->updated > 0 ? (esp_timer_get_time() - copy->updated) / 1000 : -1LL,
+                     copy->epochs,
+                     copy->num_sat,
+                     copy->num_signals,
+                     copy->cnr_avg * 10 / 16);
+    size_t pos = n < 0 ? 0 : MIN((size_t)n, len - 1);
+
+    // one line per satellite, named as in RINEX
+    for (size_t i = 0; i < copy->num_sat; i++)
+    {
+        const status_sat_t* sat = &copy->sats[i];
+        n = snprintf(buffer + pos,
+                     len - pos,
+                     "%c%02u=signals:%u,cnr_e1:%u" NEWLINE,
+                     SKY_GNSS_LETTER[sat->gnss],
+                     sat->id,
+                     sat->signals,
+                     sat->cnr * 10 / 16);
+        if (n < 0 || (size_t)n >= len - pos)
+        {
+            break;
+        }
+        pos += n;
+    }
+
+    free(copy);
+    buffer[pos] = '\0';
+    return pos;
+}
@@ -2,6 +2,9 @@
 #define ESP32S3_GNSS_STATUS_H
 
 #include <esp_err.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define STATUS_LEN_MAX 128
 
@@ -15,11 +18,69 @@ typedef enum
     STATUS_NTRIP_CAS_STATUS,
     STATUS_WIFI_STATUS,
     STATUS_BATTERY,
+    STATUS_GNSS_MODE_JOB,
+    STATUS_GNSS_SURVEY,
     STATUS_MAX
 } status_t;
 
+// decoded receiver state, fixed point so no precision is lost on the way
+typedef struct
+{
+    int64_t updated;      // us, esp_timer time of the last update
+    uint32_t utc_ms;      // ms since UTC midnight
+    uint8_t quality;      // GGA fix quality: 0 none, 1 single, 2 DGNSS, 4 RTK fixed, 5 RTK float
+    uint8_t num_sv;       // satellites used
+    uint16_t dop;         // 0.01, horizontal
+    int64_t lat;          // 1e-9 deg
+    int64_t lon;          // 1e-9 deg
+    int32_t hmsl;         // 0.1 mm above mean sea level
+    int32_t geoid_sep;    // 0.1 mm, ellipsoid above mean sea level
+    uint32_t sigma_lat;   // mm
+    uint32_t sigma_lon;   // mm
+    uint32_t sigma_alt;   // mm
+    uint8_t sat_tracked;  // satellites tracked
+    uint8_t cno_avg;      // dBHz
+    bool svin_active;     // survey-in in progress
+    bool svin_valid;      // survey-in position is valid
+    uint32_t svin_dur;    // s
+    uint32_t svin_acc;    // 0.1 mm
+    uint32_t svin_obs;    // positions averaged
+    int64_t svin_x;       // 0.1 mm, ECEF mean position
+    int64_t svin_y;       // 0.1 mm
+    int64_t svin_z;       // 0.1 mm
+} status_gnss_t;
+
+#define STATUS_SKY_GNSS_MAX 7   // GPS, GLONASS, Galileo, SBAS, QZSS, BeiDou, NavIC, in MSM type order
+#define STATUS_SKY_SAT_MAX  96  // four full constellations fit with room to spare
+
+// one satellite of the last MSM epoch
+typedef struct
+{
+    uint8_t gnss;     // index in MSM type order, 0 GPS .. 6 NavIC
+    uint8_t id;       // 1-based position in the MSM satellite mask
+    uint8_t signals;  // signals tracked
+    uint16_t cnr;     // 1/16 dBHz, strongest signal, 0 when the MSM carries no CNR
+} status_sat_t;
+
+// satellites and signals seen in the last complete MSM epoch
+typedef struct
+{
+    int64_t updated;       // us, esp_timer time of the last update
+    uint32_t epochs;       // complete epochs decoded
+    uint8_t num_sat;       // satellites in sats
+    uint16_t num_signals;  // signals of all satellites
+    uint16_t cnr_avg;      // 1/16 dBHz, over all signals that carry CNR
+    status_sat_t sats[STATUS_SKY_SAT_MAX];
+} status_sky_t;
+
 esp_err_t status_init();
 void status_set(status_t type, const char* value);
 char* status_get(status_t type);
+void status_gnss_set(const status_gnss_t* gnss);
+void status_gnss_get(status_gnss_t* gnss);
+size_t status_gnss_print(char* buffer, size_t len);
+void status_sky_set(const status_sky_t* sky);
+void status_sky_get(status_sky_t* sky);
+size_t status_sky_print(char* buffer, size_t len);
 
 #endif  // ESP32S3_GNSS_STATUS_H
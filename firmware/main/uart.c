@@ -4,23 +4,166 @@
 #include <driver/uart.h>
 #include <esp_err.h>
 #include <esp_event.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
 #include <freertos/task.h>
 #include <stdbool.h>
 #include <string.h>
 
+#include "boot.h"
 #include "config.h"
+#include "latency.h"
+#include "nmea.h"
+#include "rtcm3.h"
+#include "rtcm3_msm.h"
+#include "rtcm3_pool.h"
+#include "rtcm3_stats.h"
+#include "sdlog.h"
 #include "status.h"
 #include "ublox.h"
 #include "util.h"
 
-#define UART_STATUS_BUFFER_LEN 4096
-#define UART_RTCM3_BUFFER_LEN  8192
-#define UBX_MSG_LEN            128
+#define UART_STATUS_BUFFER_LEN      16384  // two of the longest RXM-RAWX
+#define UART_STATUS_LINE_BUFFER_LEN 16384
+#define UART_STATUS_TASK_STACK      8192
+#define UART_STATUS_RX_FULL_THRESH  112  // bytes, of a 128-byte RX FIFO
+#define UART_STATUS_RX_TIMEOUT      4    // symbols, ends a burst quickly
+#define UART_STATUS_GGA_LEN         128
+#define UART_STATUS_BAUD_RAW        460800  // raw measurements next to the status messages, with room for 10 Hz
+#define UART_RATE_WINDOW_MS         1000
+#define UART_STATUS_LOAD_WARN       80  // percent of the UART rate
+#define UART_RTCM3_BUFFER_LEN       8192
+#define UBX_ACK_TIMEOUT_MS          1000
+#define UBX_MODE_QUEUE_LEN          4
+#define UBX_MODE_KEYS_MAX           10  // keys of the largest job, the fixed base
+#define UBX_READY_POLL_MS           100
+#define UBX_READY_POLLS             20  // gives up after 2 s, the configuration still goes out
+#define UART_QUEUE_LEN              32
+#define UART_RTCM3_RX_FULL_THRESH   112  // bytes, of a 128-byte RX FIFO
+#define UART_RTCM3_RX_TIMEOUT       4    // symbols (~350 us at 115200), ends a burst quickly
+#define UART_RTCM3_BAUD_DEFAULT     921600
+#define UART_RTCM3_BAUD_PROBE_LEN   512
+#define UART_RTCM3_BAUD_PROBE_MS    500
+#define UART_RTCM3_LOAD_PERCENT     50      // of the UART rate, so an epoch leaves in half its interval
+#define UPLINK_BYTES_S_DEFAULT      100000  // bytes/s, shared by all caster clients
 
 static const char* TAG = "UART";
 
+static QueueHandle_t uart_status_queue = NULL;
+static QueueHandle_t uart_rtcm3_queue = NULL;
+static uart_stats_t uart_stats = {0};
+
+// one configuration sequence at a time, VALSET answers are matched by count
+static SemaphoreHandle_t ubx_cfg_lock = NULL;
+static SemaphoreHandle_t ubx_ack_signal = NULL;
+static uint32_t ubx_ack_lost = 0;
+static SemaphoreHandle_t ubx_valget_signal = NULL;
+static ubx_key_t ubx_valget_key = UBX_KEY_COUNT;
+static uint64_t ubx_valget_value = 0;
+static rtcm3_msm_decoder_t uart_rtcm3_msm;
+
+// GGA is only synthesized from UBX while someone listens to UART_STATUS_EVENT_READ
+static int uart_status_read_handlers = 0;
+
+// faster rates first, the receiver starts every boot at UART_RTCM3_CONFIG.baud_rate
+static const uint32_t UART_RTCM3_BAUDS[] = {921600, 460800};
+
+// every RTCM3 message a profile may enable on UART2, profiles set all of them so switching never leaves one behind
+static const ubx_key_t UBX_PROFILE_KEYS[] = {
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_UART2,
+};
+#define UBX_PROFILE_KEYS_COUNT (sizeof(UBX_PROFILE_KEYS) / sizeof(UBX_PROFILE_KEYS[0]))
+
+// the status messages on UART1, ~720 bytes an epoch with 40 satellites in NAV-SAT: 1 Hz fits 38400 baud, 5 Hz does not
+static const ubx_key_t UBX_NAV_KEYS[] = {
+    UBX_KEY_MSGOUT_UBX_NAV_PVT_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_DOP_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_SVIN_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_SAT_UART1,
+};
+#define UBX_NAV_KEYS_COUNT (sizeof(UBX_NAV_KEYS) / sizeof(UBX_NAV_KEYS[0]))
+
+typedef struct
+{
+    const char* name;
+    uint16_t meas_ms;      // CFG-RATE-MEAS
+    uint16_t epoch_bytes;  // typical epoch, 4 GNSS with ~10 satellites and 2 signals each
+    uint8_t nav_rate;      // UBX_NAV_KEYS every n epochs, keeps UART1 and the GGA posts at 1 Hz
+    uint8_t rates[UBX_PROFILE_KEYS_COUNT];  // output every n epochs, 0 disables, same order as UBX_PROFILE_KEYS
+} ubx_profile_t;
+
+// richest (highest bandwidth) first, the automatic mode takes the first one that fits
+static const ubx_profile_t UBX_PROFILES[] = {
+    {"msm7_5hz", 200, 1100, 5, {5, 0, 0, 0, 0, 1, 1, 1, 1, 5}},
+    {"msm4_5hz", 200, 700, 5, {5, 1, 1, 1, 1, 0, 0, 0, 0, 5}},
+    {"msm7", 1000, 1100, 1, {1, 0, 0, 0, 0, 1, 1, 1, 1, 1}},
+    {"msm4", 1000, 700, 1, {1, 1, 1, 1, 1, 0, 0, 0, 0, 1}},
+    {"msm4_reduced", 1000, 350, 1, {1, 1, 0, 1, 0, 0, 0, 0, 0, 0}},  // GPS + Galileo
+};
+#define UBX_PROFILES_COUNT  (sizeof(UBX_PROFILES) / sizeof(UBX_PROFILES[0]))
+#define UBX_PROFILE_DEFAULT 3  // msm4, what the firmware always sent
+#define UBX_PROFILE_AUTO    "auto"
+
+typedef enum
+{
+    UBX_JOB_MODE,         // msg, confirmed by reading back CFG-TMODE-MODE
+    UBX_JOB_PROFILE,      // profile
+    UBX_JOB_RAW_CAPTURE,  // raw_capture, may change the UART_STATUS rate
+} ubx_job_kind_t;
+
+// a mode, profile or raw capture change, encoded by the caller and applied by ubx_mode_task
+typedef struct
+{
+    uint32_t id;
+    ubx_job_kind_t kind;
+    const char* mode;              // status text, once the receiver runs it
+    uint8_t tmode;                 // CFG-TMODE-MODE read back to confirm
+    const ubx_profile_t* profile;  // the profile to apply
+    bool profile_auto;             // ubx_select_profile picks the profile when the job runs
+    bool raw_capture;              // raw measurements on or off
+    uint32_t len;
+    uint8_t msg[UBX_VALSET_LEN(UBX_MODE_KEYS_MAX)];
+} ubx_mode_job_t;
+
+static QueueHandle_t ubx_mode_queue = NULL;
+static uint32_t ubx_mode_job_id = 0;
+static portMUX_TYPE ubx_mode_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// receiver time of the last RXM-RAWX, -1 until the first one of a capture or measurement rate
+static int64_t ubx_rawx_last_ms = -1;
+// set by ubx_mode_task, uart_status_task owns the RXM-RAWX timing and starts it over
+static volatile bool ubx_rawx_restart = false;
+
+// NAV messages seen of the current navigation epoch, the GGA goes out once PVT, DOP and HPPOSLLH of one itow are in
+#define UBX_EPOCH_PVT      0x01
+#define UBX_EPOCH_DOP      0x02
+#define UBX_EPOCH_HPPOSLLH 0x04
+#define UBX_EPOCH_ALL      (UBX_EPOCH_PVT | UBX_EPOCH_DOP | UBX_EPOCH_HPPOSLLH)
+static uint32_t ubx_epoch_itow = 0;
+static uint8_t ubx_epoch_seen = 0;
+static ubx_nav_pvt_t ubx_epoch_pvt;
+// the position comes from HPPOSLLH, NAV-PVT only stands in while HPPOSLLH is invalid
+static bool ubx_position_hp = false;
+
+static const ubx_profile_t* ubx_profile = NULL;
+static bool ubx_profile_auto = false;
+static int ubx_profile_clients = 0;
+static bool ubx_profile_update_queued = false;  // an automatic pick is waiting on ubx_mode_task
+
 ESP_EVENT_DEFINE_BASE(UART_STATUS_EVENT_READ);
+ESP_EVENT_DEFINE_BASE(UART_STATUS_EVENT_SURVEY);
 // UART1 is connected to U-blox UART1, for sending CFG, and reading GGA
 const uart_port_t UART_STATUS_PORT = UART_NUM_1;
 const uint8_t UART_STATUS_PIN_TX = GPIO_NUM_40;
@@ -34,7 +177,6 @@ const uart_config_t UART_STATUS_CONFIG = {
     .source_clk = UART_SCLK_DEFAULT,
 };
 
-ESP_EVENT_DEFINE_BASE(UART_RTCM3_EVENT_READ);
 // UART2 is connected to U-blox UART2, for sending or reading RTCM3
 const uart_port_t UART_RTCM3_PORT = UART_NUM_2;
 const uint8_t UART_RTCM3_PIN_TX = GPIO_NUM_38;
@@ -50,127 +192,366 @@ const uart_config_t UART_RTCM3_CONFIG = {
 
 void uart_register_handler(esp_event_base_t event_base, esp_event_handler_t event_handler)
 {
-    esp_event_handler_register(event_base, ESP_EVENT_ANY_ID, event_handler, NULL);
+    if (esp_event_handler_register(event_base, ESP_EVENT_ANY_ID, event_handler, NULL) == ESP_OK && event_base == UART_STATUS_EVENT_READ)
+    {
+        uart_status_read_handlers++;
+    }
 }
 
 void uart_unregister_handler(esp_event_base_t event_base, esp_event_handler_t event_handler)
 {
-    esp_event_handler_unregister(event_base, ESP_EVENT_ANY_ID, event_handler);
+    if (esp_event_handler_unregister(event_base, ESP_EVENT_ANY_ID, event_handler) == ESP_OK && event_base == UART_STATUS_EVENT_READ)
+    {
+        uart_status_read_handlers--;
+    }
+}
+
+static void ubx_write_valset(const uint8_t* msg, uint32_t len)
+{
+    uart_write_bytes(UART_STATUS_PORT, msg, len);
+    uart_stats.ubx_valsets++;
 }
 
-void ubx_set_default()
+static bool ubx_send_valset(ubx_valset_t* valset)
 {
-    uint8_t* buffer = calloc(32, sizeof(uint8_t));
-    uint32_t n;
+    uint32_t n = ubx_valset_end(valset);
+    ERROR_IF(n == 0, return false, "Cannot encode UBX CFG-VALSET");
 
-    /*
-     * UART 1
-     */
-    // NMEA ouput is enabled by default; only keep GGA, GST; disable GLL, GSA, GSV, RMC, VTG, TXT
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_GGA_UART1 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_GST_UART1 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_GLL_UART1 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_GSA_UART1 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_GSV_UART1 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_RMC_UART1 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_VTG_UART1 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_TXT_UART1 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
+    ubx_write_valset(valset->buff, n);
+    return true;
+}
+
+static esp_err_t ubx_wait_ack(uint32_t naks)
+{
+    int64_t deadline = esp_timer_get_time() + UBX_ACK_TIMEOUT_MS * 1000LL;
+
+    // every VALSET is answered by one ACK-ACK or ACK-NAK, in order
+    while (uart_stats.ubx_acks + uart_stats.ubx_naks + ubx_ack_lost < uart_stats.ubx_valsets)
+    {
+        int64_t remaining = deadline - esp_timer_get_time();
+        if (remaining <= 0)
+        {
+            // forget the missing answers, so the next batch is not blamed for them
+            uart_stats.ubx_ack_timeouts++;
+            ubx_ack_lost = uart_stats.ubx_valsets - uart_stats.ubx_acks - uart_stats.ubx_naks;
+            ESP_LOGW(TAG, "No UBX ACK for CFG-VALSET");
+            return ESP_ERR_TIMEOUT;
+        }
+        xSemaphoreTake(ubx_ack_signal, pdMS_TO_TICKS(remaining / 1000 + 1));
+    }
+
+    ERROR_IF(uart_stats.ubx_naks != naks, return ESP_FAIL, "UBX NAK for CFG-VALSET");
+    return ESP_OK;
+}
+
+// one VALSET, returns once the receiver answered it
+static esp_err_t ubx_valset_sync(ubx_valset_t* valset)
+{
+    xSemaphoreTakeRecursive(ubx_cfg_lock, portMAX_DELAY);
+    uint32_t naks = uart_stats.ubx_naks;
+    esp_err_t err = ubx_send_valset(valset) ? ubx_wait_ack(naks) : ESP_ERR_INVALID_ARG;
+    xSemaphoreGiveRecursive(ubx_cfg_lock);
+    return err;
+}
+
+static void ubx_ack(const uint8_t* msg, size_t len)
+{
+    // only VALSET answers are counted, the payload names the acknowledged message
+    if (len < UBX_HEADER_LEN + 2 + UBX_CHECKSUM_LEN || msg[UBX_HEADER_LEN] != UBX_CLS_CFG || msg[UBX_HEADER_LEN + 1] != UBX_ID_CFG_VALSET)
+    {
+        return;
+    }
+
+    if (msg[3] == UBX_ID_ACK_ACK)
+    {
+        uart_stats.ubx_acks++;
+    }
+    else
+    {
+        uart_stats.ubx_naks++;
+    }
+    xSemaphoreGive(ubx_ack_signal);
+}
+
+// read one key back from the RAM layer
+static esp_err_t ubx_valget(ubx_key_t key, uint64_t* val)
+{
+    uint8_t poll[16];
+
+    xSemaphoreTake(ubx_valget_signal, 0);
+    ubx_valget_key = key;
+    uart_write_bytes(UART_STATUS_PORT, poll, ubx_gen_valget(key, 0, poll));
+
+    ERROR_IF(xSemaphoreTake(ubx_valget_signal, pdMS_TO_TICKS(UBX_ACK_TIMEOUT_MS)) != pdTRUE, return ESP_ERR_TIMEOUT, "No UBX CFG-VALGET answer");
+    *val = ubx_valget_value;
+    return ESP_OK;
+}
+
+static void ubx_valget_answer(const uint8_t* msg, size_t len)
+{
+    if (ubx_valget_key != UBX_KEY_COUNT && ubx_decode_cfg_valget(msg, len, ubx_valget_key, &ubx_valget_value))
+    {
+        ubx_valget_key = UBX_KEY_COUNT;
+        xSemaphoreGive(ubx_valget_signal);
+    }
+}
+
+static void ubx_send_default()
+{
+    uint8_t buffer[UBX_VALSET_LEN(17)];
+    ubx_valset_t valset;
+    ubx_valset_begin(&valset, buffer, sizeof(buffer), UBX_LAYER_RAM);
+
+    // UART1: NMEA ouput is enabled by default; status is read from UBX now, disable GGA, GST, GLL, GSA, GSV, RMC, VTG, TXT
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_NMEA_ID_GGA_UART1, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_NMEA_ID_GST_UART1, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_NMEA_ID_GLL_UART1, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_NMEA_ID_GSA_UART1, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_NMEA_ID_GSV_UART1, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_NMEA_ID_RMC_UART1, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_NMEA_ID_VTG_UART1, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_INFMSG_NMEA_UART1, 0);
 
     // Enable High Precision mode
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-NMEA-HIGHPREC 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
+    ubx_valset_add_u1(&valset, UBX_KEY_NMEA_HIGHPREC, 1);
+
+    // UBX output is enabled by default; solution, HDOP for the GGA, high precision position, survey-in and satellites come with the profile
+
+    // raw measurements only during a capture, an ESP reset ends it
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_UBX_RXM_RAWX_UART1, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_UBX_RXM_SFRBX_UART1, 0);
 
     // RTCM3 input/output should be disabled
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART1INPROT-RTCM3X 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART1OUTPROT-RTCM3X 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART1INPROT_RTCM3X, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART1OUTPROT_RTCM3X, 0);
 
-    /*
-     * UART 2
-     */
-    // Set Baudraet
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART2-BAUDRATE 115200", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    // NMEA input and NMEA output are disabled by default
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART2OUTPROT-NMEA 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    // UBX input is enabled, UBX output is disabled by default
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART2OUTPROT-UBX 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    // RTCM3 input and RTCM3 output are enabled by default
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART2OUTPROT-RTCM3X 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    // default measurement rate is 1 Hz
-    // n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-RATE-MEAS 1", buffer);
-    // uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    // set output rate of recommended RTCM3 messages
-    //// RTCM 1005 Stationary RTK reference station ARP
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-RTCM_3X_TYPE1005_UART2 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    //// RTCM 1074 GPS MSM4
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-RTCM_3X_TYPE1074_UART2 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    //// RTCM 1084 GLONASS MSM4
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-RTCM_3X_TYPE1084_UART2 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    //// RTCM 1094 Galileo MSM4
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-RTCM_3X_TYPE1094_UART2 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    //// RTCM 1124 BeiDou MSM4
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-RTCM_3X_TYPE1124_UART2 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-    //// RTCM 1230 GLONASS code-phase biases
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-MSGOUT-RTCM_3X_TYPE1230_UART2 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
+    // UART2: start at 115200, NMEA and UBX output are disabled, RTCM3 output waits for a base mode
+    ubx_valset_add_u4(&valset, UBX_KEY_UART2_BAUDRATE, 115200);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART2OUTPROT_NMEA, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART2OUTPROT_UBX, 0);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART2OUTPROT_RTCM3X, 0);
+
+    ubx_send_valset(&valset);
+}
+
+// TMODE Disabled, no RTCM3 output on UART2
+static void ubx_add_mode_rover(ubx_valset_t* valset)
+{
+    ubx_valset_add_u1(valset, UBX_KEY_TMODE_MODE, 0);
+    ubx_valset_add_u1(valset, UBX_KEY_UART2OUTPROT_RTCM3X, 0);
+}
+
+static void ubx_apply_profile(const ubx_profile_t* profile)
+{
+    uint8_t buffer[UBX_VALSET_LEN(1 + UBX_NAV_KEYS_COUNT + UBX_PROFILE_KEYS_COUNT)];
+    ubx_valset_t valset;
+    ubx_valset_begin(&valset, buffer, sizeof(buffer), UBX_LAYER_RAM);
+
+    // one message, so the receiver never sends a mix of two profiles
+    ubx_valset_add_u2(&valset, UBX_KEY_RATE_MEAS, profile->meas_ms);
+    // learn the RXM-RAWX period again
+    ubx_rawx_restart = true;
+    for (size_t i = 0; i < UBX_NAV_KEYS_COUNT; i++)
+    {
+        ubx_valset_add_u1(&valset, UBX_NAV_KEYS[i], profile->nav_rate);
+    }
+    for (size_t i = 0; i < UBX_PROFILE_KEYS_COUNT; i++)
+    {
+        ubx_valset_add_u1(&valset, UBX_PROFILE_KEYS[i], profile->rates[i]);
+    }
+    ubx_send_valset(&valset);
+
+    ubx_profile = profile;
+    ESP_LOGI(TAG, "RTCM3 profile: %s", profile->name);
+}
+
+static const ubx_profile_t* ubx_select_profile()
+{
+    uint32_t uplink = UPLINK_BYTES_S_DEFAULT;
+    char* value = config_get(CONFIG_UPLINK_BYTES_S);
+    if (strlen(value) > 0 && atoi(value) > 0)
+    {
+        uplink = atoi(value);
+    }
+
+    // the receiver always boots at 115200 before the rate is negotiated
+    uint32_t baud = uart_stats.rtcm3_baud > 0 ? uart_stats.rtcm3_baud : 115200;
+
+    // scale the typical sizes by what the current profile really produces
+    uint32_t measured = uart_stats.rtcm3_epoch_bytes;
+    uint32_t expected = ubx_profile != NULL ? ubx_profile->epoch_bytes : 0;
+
+    for (size_t i = 0; i < UBX_PROFILES_COUNT; i++)
+    {
+        uint64_t epoch_bytes = UBX_PROFILES[i].epoch_bytes;
+        if (measured > 0 && expected > 0)
+        {
+            epoch_bytes = epoch_bytes * measured / expected;
+        }
+        uint64_t rate = epoch_bytes * 1000 / UBX_PROFILES[i].meas_ms;  // bytes/s
+
+        // the UART carries one copy, the uplink one per client
+        if (rate * 10 * 100 <= (uint64_t)baud * UART_RTCM3_LOAD_PERCENT && rate * MAX(ubx_profile_clients, 1) <= uplink)
+        {
+            return &UBX_PROFILES[i];
+        }
+    }
+
+    return &UBX_PROFILES[UBX_PROFILES_COUNT - 1];
+}
+
+static const ubx_profile_t* ubx_find_profile(const char* name, bool* automatic)
+{
+    if (name == NULL || strlen(name) == 0)
+    {
+        name = UBX_PROFILES[UBX_PROFILE_DEFAULT].name;
+    }
+
+    *automatic = strcmp(name, UBX_PROFILE_AUTO) == 0;
+    if (*automatic)
+    {
+        return ubx_select_profile();
+    }
+
+    for (size_t i = 0; i < UBX_PROFILES_COUNT; i++)
+    {
+        if (strcmp(name, UBX_PROFILES[i].name) == 0)
+        {
+            return &UBX_PROFILES[i];
+        }
+    }
+
+    ESP_LOGE(TAG, "Unknown RTCM3 profile: %s", name);
+    return NULL;
+}
+
+void ubx_set_default()
+{
+    int64_t start = esp_timer_get_time();
+
+    xSemaphoreTakeRecursive(ubx_cfg_lock, portMAX_DELAY);
+    uint32_t naks = uart_stats.ubx_naks;
+
+    // three VALSETs back to back, then a single wait for all answers
+    ubx_send_default();
+
+    // RTCM3 messages and measurement rate come from the output profile
+    const ubx_profile_t* profile = ubx_find_profile(config_get(CONFIG_RTCM3_PROFILE), &ubx_profile_auto);
+    ubx_apply_profile(profile != NULL ? profile : &UBX_PROFILES[UBX_PROFILE_DEFAULT]);
 
     /*
      * MODE
      */
     // default in rover mode
-    ubx_set_mode_rover();
+    uint8_t buffer[UBX_VALSET_LEN(2)];
+    ubx_valset_t valset;
+    ubx_valset_begin(&valset, buffer, sizeof(buffer), UBX_LAYER_RAM);
+    ubx_add_mode_rover(&valset);
+    ubx_send_valset(&valset);
 
-    free(buffer);
+    esp_err_t err = ubx_wait_ack(naks);
+    xSemaphoreGiveRecursive(ubx_cfg_lock);
+
+    uart_stats.ubx_config_us = esp_timer_get_time() - start;
+    ESP_LOGI(TAG, "UBX default config: %s in %lu us", esp_err_to_name(err), uart_stats.ubx_config_us);
+    status_set(STATUS_GNSS_MODE, "Rover");
 }
 
-void ubx_set_mode_rover()
+static void ubx_mode_progress(const ubx_mode_job_t* job, const char* state)
 {
-    uint8_t* buffer = calloc(32, sizeof(uint8_t));
-    uint32_t n;
+    char text[STATUS_LEN_MAX];
+    snprintf(text, sizeof(text), "%lu:%s:%s", job->id, job->mode, state);
+    status_set(STATUS_GNSS_MODE_JOB, text);
+}
 
-    // TMODE Disabled
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-TMODE-MODE 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
+// hand the job to ubx_mode_task, the caller gets the job id right away
+static uint32_t ubx_mode_queue_job(ubx_mode_job_t* job)
+{
+    // the web app may come up before the UART ports
+    ERROR_IF(ubx_mode_queue == NULL, return 0, "UART is not started");
 
-    // Disable RTCM3 output on UART2
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART2OUTPROT-RTCM3X 0", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
+    portENTER_CRITICAL(&ubx_mode_lock);
+    job->id = ++ubx_mode_job_id;
+    portEXIT_CRITICAL(&ubx_mode_lock);
 
-    free(buffer);
+    ERROR_IF(xQueueSend(ubx_mode_queue, job, 0) != pdTRUE, return 0, "UBX mode queue is full");
+    ubx_mode_progress(job, "queued");
+    return job->id;
+}
 
-    vTaskDelay(pdMS_TO_TICKS(1000));
+static uint32_t ubx_mode_start(ubx_mode_job_t* job, ubx_valset_t* valset, const char* mode, uint8_t tmode)
+{
+    job->len = ubx_valset_end(valset);
+    ERROR_IF(job->len == 0, return 0, "Cannot encode UBX mode %s", mode);
+    job->kind = UBX_JOB_MODE;
+    job->mode = mode;
+    job->tmode = tmode;
+    return ubx_mode_queue_job(job);
+}
 
-    status_set(STATUS_GNSS_MODE, "Rover");
+uint32_t ubx_set_profile(const char* name)
+{
+    ubx_mode_job_t job;
+
+    // an automatic profile is picked again when the job runs, and on later client changes
+    job.profile = ubx_find_profile(name, &job.profile_auto);
+    if (job.profile == NULL)
+    {
+        return 0;
+    }
+    job.kind = UBX_JOB_PROFILE;
+    job.mode = job.profile_auto ? UBX_PROFILE_AUTO : job.profile->name;
+    job.tmode = 0;
+    job.len = 0;
+    return ubx_mode_queue_job(&job);
 }
 
-void ubx_set_mode_survey(const char* dur, const char* acc)
+void ubx_update_profile(int clients)
 {
-    uint8_t* buffer = calloc(32, sizeof(uint8_t));
-    char* msg = calloc(UBX_MSG_LEN, sizeof(char));
-    uint32_t n;
+    ubx_mode_job_t job;
+
+    ubx_profile_clients = clients;
+    if (!ubx_profile_auto)
+    {
+        return;
+    }
+
+    // called from the RTCM3 dispatcher and the httpd task with the client list locked, never wait there;
+    // one queued pick is enough, it sees the client count of when it runs
+    portENTER_CRITICAL(&ubx_mode_lock);
+    bool queued = ubx_profile_update_queued;
+    ubx_profile_update_queued = true;
+    portEXIT_CRITICAL(&ubx_mode_lock);
+    if (queued)
+    {
+        return;
+    }
+
+    job.kind = UBX_JOB_PROFILE;
+    job.mode = UBX_PROFILE_AUTO;
+    job.tmode = 0;
+    job.profile = NULL;
+    job.profile_auto = true;
+    job.len = 0;
+    if (ubx_mode_queue_job(&job) == 0)
+    {
+        ubx_profile_update_queued = false;
+    }
+}
+
+uint32_t ubx_set_mode_rover()
+{
+    ubx_mode_job_t job;
+    ubx_valset_t valset;
+    ubx_valset_begin(&valset, job.msg, sizeof(job.msg), UBX_LAYER_RAM);
+    ubx_add_mode_rover(&valset);
+    return ubx_mode_start(&job, &valset, "Rover", 0);
+}
+
+uint32_t ubx_set_mode_survey(const char* dur, const char* acc)
+{
+    ubx_mode_job_t job;
+    ubx_valset_t valset;
     int duration = atoi(dur);
     int accuracy = atoi(acc);
 
@@ -185,109 +566,78 @@ void ubx_set_mode_survey(const char* dur, const char* acc)
     }
 
     // Survey in 5 mins = 300 seconds
-    snprintf(msg, UBX_MSG_LEN, "CFG-VALSET 0 1 0 0 CFG-TMODE-SVIN_MIN_DUR %d", duration);
-    n = ubx_gen_cmd(msg, buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
     // Accuracy in 5000 x 0.1 = 500 mm = 50 cm
-    snprintf(msg, UBX_MSG_LEN, "CFG-VALSET 0 1 0 0 CFG-TMODE-SVIN_ACC_LIMIT %d", accuracy);
-    n = ubx_gen_cmd(msg, buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
     // TMODE Enabled in Survey-in mode
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-TMODE-MODE 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
     // Enable RTCM3 output on UART2
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART2OUTPROT-RTCM3X 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    free(msg);
-    free(buffer);
-
-    vTaskDelay(pdMS_TO_TICKS(1000));
-
-    status_set(STATUS_GNSS_MODE, "Base-Survey");
+    ubx_valset_begin(&valset, job.msg, sizeof(job.msg), UBX_LAYER_RAM);
+    ubx_valset_add_u4(&valset, UBX_KEY_TMODE_SVIN_MIN_DUR, duration);
+    ubx_valset_add_u4(&valset, UBX_KEY_TMODE_SVIN_ACC_LIMIT, accuracy);
+    ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 1);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART2OUTPROT_RTCM3X, 1);
+    return ubx_mode_start(&job, &valset, "Base-Survey", 1);
 }
 
-static bool set_msg_with_val_scale(char* buffer, size_t buffer_len, const char* msg, const char* val, int scale)
+// decimal text to an integer in units of 10^-scale, missing digits are zeros and extra digits are dropped
+static bool parse_val_scale(const char* val, int scale, int64_t* out)
 {
     const char* decimal = strchr(val, '.');
     ERROR_IF(decimal == NULL, return false, "Invalid coordinate format: %s", val);
 
-    int integer_len = (int)(decimal - val);
-    ERROR_IF(integer_len <= 0, return false, "Invalid coordinate integer part: %s", val);
+    bool negative = val[0] == '-';
+    const char* digit = negative || val[0] == '+' ? val + 1 : val;
+    ERROR_IF(digit == decimal, return false, "Invalid coordinate integer part: %s", val);
+
+    int64_t value = 0;
+    for (; digit < decimal; digit++)
+    {
+        ERROR_IF(*digit < '0' || *digit > '9', return false, "Invalid coordinate digit: %s", val);
+        value = value * 10 + (*digit - '0');
+    }
 
-    size_t fractional_len = strlen(decimal + 1);
-    ERROR_IF(fractional_len < (size_t)scale, return false, "Invalid coordinate precision: %s", val);
+    for (digit = decimal + 1; scale > 0; scale--)
+    {
+        int d = 0;
+        if (*digit != '\0')
+        {
+            ERROR_IF(*digit < '0' || *digit > '9', return false, "Invalid coordinate digit: %s", val);
+            d = *digit++ - '0';
+        }
+        value = value * 10 + d;
+    }
 
-    int written = snprintf(buffer, buffer_len, "%s%.*s%.*s", msg, integer_len, val, scale, decimal + 1);
-    ERROR_IF(written < 0 || written >= (int)buffer_len, return false, "UBX command is too long");
+    *out = negative ? -value : value;
     return true;
 }
 
-void ubx_set_mode_fixed(const char* lat, const char* lon, const char* alt)
+uint32_t ubx_set_mode_fixed(const char* lat, const char* lon, const char* alt)
 {
-    char* msg = calloc(UBX_MSG_LEN, sizeof(char));
-    uint8_t* buffer = calloc(UBX_MSG_LEN, sizeof(uint8_t));
-    uint32_t n;
+    ubx_mode_job_t job;
+    ubx_valset_t valset;
+    int64_t lat_e9, lon_e9, alt_e4;
+
+    // LAT/LON in 10^-7 deg with 10^-9 deg high precision part, HEIGHT in cm with 0.1 mm part, both parts keep the sign
+    ERROR_IF(!parse_val_scale(lat, 9, &lat_e9), return 0, "Cannot encode latitude");
+    ERROR_IF(!parse_val_scale(lon, 9, &lon_e9), return 0, "Cannot encode longitude");
+    ERROR_IF(!parse_val_scale(alt, 4, &alt_e4), return 0, "Cannot encode altitude");
 
     // POS LLH
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-TMODE-POS_TYPE 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    // LAT in scale of 10^-7
-    memset(msg, 0, UBX_MSG_LEN);
-    ERROR_IF(!set_msg_with_val_scale(msg, UBX_MSG_LEN, "CFG-VALSET 0 1 0 0 CFG-TMODE-LAT ", lat, 7), goto ubx_set_mode_fixed_end, "Cannot encode latitude");
-    n = ubx_gen_cmd(msg, buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    memset(msg, 0, UBX_MSG_LEN);
-    sprintf(msg, "CFG-VALSET 0 1 0 0 CFG-TMODE-LAT_HP %s", &lat[strlen(lat) - 2]);
-    n = ubx_gen_cmd(msg, buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    // LON in scale of 10^-7
-    memset(msg, 0, UBX_MSG_LEN);
-    ERROR_IF(!set_msg_with_val_scale(msg, UBX_MSG_LEN, "CFG-VALSET 0 1 0 0 CFG-TMODE-LON ", lon, 7), goto ubx_set_mode_fixed_end, "Cannot encode longitude");
-    n = ubx_gen_cmd(msg, buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    memset(msg, 0, UBX_MSG_LEN);
-    sprintf(msg, "CFG-VALSET 0 1 0 0 CFG-TMODE-LON_HP %s", &lon[strlen(lon) - 2]);
-    n = ubx_gen_cmd(msg, buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    // HEIGHT in cm
-    memset(msg, 0, UBX_MSG_LEN);
-    ERROR_IF(!set_msg_with_val_scale(msg, UBX_MSG_LEN, "CFG-VALSET 0 1 0 0 CFG-TMODE-HEIGHT ", alt, 2), goto ubx_set_mode_fixed_end, "Cannot encode altitude");
-    n = ubx_gen_cmd(msg, buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
-    memset(msg, 0, UBX_MSG_LEN);
-    sprintf(msg, "CFG-VALSET 0 1 0 0 CFG-TMODE-HEIGHT_HP %s0", &alt[strlen(alt) - 1]);
-    n = ubx_gen_cmd(msg, buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
+    ubx_valset_begin(&valset, job.msg, sizeof(job.msg), UBX_LAYER_RAM);
+    ubx_valset_add_u1(&valset, UBX_KEY_TMODE_POS_TYPE, 1);
+    ubx_valset_add_i4(&valset, UBX_KEY_TMODE_LAT, lat_e9 / 100);
+    ubx_valset_add_i1(&valset, UBX_KEY_TMODE_LAT_HP, lat_e9 % 100);
+    ubx_valset_add_i4(&valset, UBX_KEY_TMODE_LON, lon_e9 / 100);
+    ubx_valset_add_i1(&valset, UBX_KEY_TMODE_LON_HP, lon_e9 % 100);
+    ubx_valset_add_i4(&valset, UBX_KEY_TMODE_HEIGHT, alt_e4 / 100);
+    ubx_valset_add_i1(&valset, UBX_KEY_TMODE_HEIGHT_HP, alt_e4 % 100);
 
     // ACC = 500 x 0.1 = 50mm = 5 cm
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-TMODE-FIXED_POS_ACC 500", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
     // TMODE Enabled in Fixed mode
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-TMODE-MODE 2", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
-
     // Enable RTCM3 output on UART2
-    n = ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-UART2OUTPROT-RTCM3X 1", buffer);
-    uart_write_bytes(UART_STATUS_PORT, buffer, n);
+    ubx_valset_add_u4(&valset, UBX_KEY_TMODE_FIXED_POS_ACC, 500);
+    ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 2);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART2OUTPROT_RTCM3X, 1);
 
-ubx_set_mode_fixed_end:
-    free(msg);
-    free(buffer);
-
-    vTaskDelay(pdMS_TO_TICKS(1000));
-
-    status_set(STATUS_GNSS_MODE, "Base-Fixed");
+    return ubx_mode_start(&job, &valset, "Base-Fixed", 2);
 }
 
 void ubx_write_rtcm3(const char* buffer, size_t len)
@@ -295,78 +645,885 @@ void ubx_write_rtcm3(const char* buffer, size_t len)
     uart_write_bytes(UART_RTCM3_PORT, buffer, len);
 }
 
+size_t uart_stats_print(char* buffer, size_t len)
+{
+    int n = snprintf(buffer,
+                     len,
+                     "uptime_ms=%lld" NEWLINE "status_wakeups=%lu" NEWLINE "status_lines=%lu" NEWLINE "status_nmea_errors=%lu" NEWLINE
+                     "status_ubx=%lu" NEWLINE "status_ubx_errors=%lu" NEWLINE "status_overflows=%lu" NEWLINE "rtcm3_wakeups=%lu" NEWLINE
+                     "rtcm3_empty_wakeups=%lu" NEWLINE "rtcm3_bytes=%lu" NEWLINE "rtcm3_frames=%lu" NEWLINE "rtcm3_crc_errors=%lu" NEWLINE
+                     "rtcm3_skipped=%lu" NEWLINE "rtcm3_overflows=%lu" NEWLINE "rtcm3_baud=%lu" NEWLINE "rtcm3_epoch_bytes=%lu" NEWLINE
+                     "rtcm3_epoch_bytes_max=%lu" NEWLINE "rtcm3_epoch_serial_us=%lu" NEWLINE "rtcm3_epoch_serial_us_115200=%lu" NEWLINE
+                     "rtcm3_profile=%s%s" NEWLINE "rtcm3_msm_layouts=%lu" NEWLINE "rtcm3_msm_errors=%lu" NEWLINE "ubx_valsets=%lu" NEWLINE
+                     "ubx_acks=%lu" NEWLINE "ubx_naks=%lu" NEWLINE "ubx_ack_timeouts=%lu" NEWLINE "ubx_config_us=%lu" NEWLINE "ubx_mode_us=%lu" NEWLINE
+                     "status_baud=%lu" NEWLINE "status_bytes=%lu" NEWLINE "status_bytes_per_s=%lu" NEWLINE "status_load=%lu" NEWLINE
+                     "status_load_max=%lu" NEWLINE "ubx_raw_capture=%lu" NEWLINE "ubx_rawx=%lu" NEWLINE "ubx_sfrbx=%lu" NEWLINE
+                     "ubx_rawx_period_ms=%lu" NEWLINE "ubx_rawx_gaps=%lu" NEWLINE "ubx_rawx_missed=%lu" NEWLINE "status_events=%lu" NEWLINE
+                     "status_wakeups_per_s=%lu" NEWLINE "status_wait_us_max=%lu" NEWLINE "rtcm3_events=%lu" NEWLINE "rtcm3_wakeups_per_s=%lu" NEWLINE
+                     "rtcm3_wait_us=%lu" NEWLINE "rtcm3_wait_us_max=%lu" NEWLINE,
+                     esp_timer_get_time() / 1000,
+                     uart_stats.status_wakeups,
+                     uart_stats.status_lines,
+                     uart_stats.status_nmea_errors,
+                     uart_stats.status_ubx,
+                     uart_stats.status_ubx_errors,
+                     uart_stats.status_overflows,
+                     uart_stats.rtcm3_wakeups,
+                     uart_stats.rtcm3_empty_wakeups,
+                     uart_stats.rtcm3_bytes,
+                     uart_stats.rtcm3_frames,
+                     uart_stats.rtcm3_crc_errors,
+                     uart_stats.rtcm3_skipped,
+                     uart_stats.rtcm3_overflows,
+                     uart_stats.rtcm3_baud,
+                     uart_stats.rtcm3_epoch_bytes,
+                     uart_stats.rtcm3_epoch_bytes_max,
+                     // 10 bits per byte on the wire: start, 8 data, stop
+                     (uint32_t)(uart_stats.rtcm3_epoch_bytes * 10ULL * 1000000 / MAX(uart_stats.rtcm3_baud, 1)),
+                     (uint32_t)(uart_stats.rtcm3_epoch_bytes * 10ULL * 1000000 / 115200),
+                     ubx_profile_auto ? "auto:" : "",
+                     ubx_profile != NULL ? ubx_profile->name : "",
+                     uart_stats.rtcm3_msm_layouts,
+                     uart_stats.rtcm3_msm_errors,
+                     uart_stats.ubx_valsets,
+                     uart_stats.ubx_acks,
+                     uart_stats.ubx_naks,
+                     uart_stats.ubx_ack_timeouts,
+                     uart_stats.ubx_config_us,
+                     uart_stats.ubx_mode_us,
+                     uart_stats.status_baud,
+                     uart_stats.status_bytes,
+                     uart_stats.status_bytes_per_s,
+                     uart_stats.status_load,
+                     uart_stats.status_load_max,
+                     uart_stats.ubx_raw_capture,
+                     uart_stats.ubx_rawx,
+                     uart_stats.ubx_sfrbx,
+                     uart_stats.ubx_rawx_period_ms,
+                     uart_stats.ubx_rawx_gaps,
+                     uart_stats.ubx_rawx_missed,
+                     uart_stats.status_events,
+                     uart_stats.status_wakeups_per_s,
+                     uart_stats.status_wait_us_max,
+                     uart_stats.rtcm3_events,
+                     uart_stats.rtcm3_wakeups_per_s,
+                     uart_stats.rtcm3_wait_us,
+                     uart_stats.rtcm3_wait_us_max);
+    return n < 0 ? 0 : MIN((size_t)n, len - 1);
+}
+
+// fallback for a receiver that only emits NMEA: ubx_send_default turns GGA, GST and RMC off on UART1, so the
+// default configuration never gets here and the status comes from uart_status_ubx; lines still arrive when the
+// configuration did not reach the receiver, or when NMEA output is enabled again from u-center
+static void uart_status_line(const char* line, size_t len, status_gnss_t* gnss)
+{
+    nmea_index_t index;
+    nmea_gga_t gga;
+    nmea_gst_t gst;
+    nmea_rmc_t rmc;
+
+    // nothing unvalidated reaches the status or the NTRIP upload
+    if (!nmea_parse(line, len, &index))
+    {
+        uart_stats.status_nmea_errors++;
+        return;
+    }
+
+    if (nmea_decode_gga(&index, &gga))
+    {
+        gnss->utc_ms = gga.utc_ms;
+        gnss->quality = gga.quality;
+        gnss->num_sv = gga.num_sv;
+        gnss->dop = gga.hdop;
+        gnss->lat = gga.lat;
+        gnss->lon = gga.lon;
+        gnss->hmsl = gga.hmsl;
+        gnss->geoid_sep = gga.geoid_sep;
+        esp_event_post(UART_STATUS_EVENT_READ, len /* use len as event ID */, line, len, portMAX_DELAY);
+    }
+    else if (nmea_decode_gst(&index, &gst))
+    {
+        gnss->sigma_lat = gst.sigma_lat;
+        gnss->sigma_lon = gst.sigma_lon;
+        gnss->sigma_alt = gst.sigma_alt;
+    }
+    else if (nmea_decode_rmc(&index, &rmc))
+    {
+        gnss->utc_ms = rmc.utc_ms;
+    }
+    else
+    {
+        return;
+    }
+
+    gnss->updated = esp_timer_get_time();
+    status_gnss_set(gnss);
+}
+
+// state:duration s:observations:mean accuracy 0.1 mm, updated on every NAV-SVIN
+static void ubx_survey_progress(const ubx_nav_svin_t* svin)
+{
+    char text[STATUS_LEN_MAX];
+    snprintf(text, sizeof(text), "%s:%lu:%lu:%lu", svin->active ? "running" : svin->valid ? "done" : "idle", svin->dur, svin->obs, svin->mean_acc);
+    status_set(STATUS_GNSS_SURVEY, text);
+}
+
+static void ubx_raw_capture(const uint8_t* msg, size_t len)
+{
+    ubx_rxm_rawx_t rawx;
+
+    if (msg[3] == UBX_ID_RXM_SFRBX)
+    {
+        uart_stats.ubx_sfrbx++;
+        return;
+    }
+
+    if (msg[3] != UBX_ID_RXM_RAWX || !ubx_decode_rxm_rawx(msg, len, &rawx))
+    {
+        return;
+    }
+
+    // the epoch is already in the log buffer, write it out
+    uart_stats.ubx_rawx++;
+    sdlog_epoch(SDLOG_RAWX);
+
+    if (ubx_rawx_restart)
+    {
+        ubx_rawx_restart = false;
+        ubx_rawx_last_ms = -1;
+        uart_stats.ubx_rawx_period_ms = 0;
+    }
+
+    // epochs are one measurement period apart, a longer step lost RXM-RAWX on the way
+    int64_t time_ms = rawx.week * 604800000LL + (int64_t)(rawx.rcv_tow * 1000 + 0.5);
+    int64_t step = ubx_rawx_last_ms >= 0 ? time_ms - ubx_rawx_last_ms : 0;
+    uint32_t period = uart_stats.ubx_rawx_period_ms;
+    ubx_rawx_last_ms = time_ms;
+    if (step <= 0)
+    {
+        return;
+    }
+
+    if (period == 0 || step < period)
+    {
+        uart_stats.ubx_rawx_period_ms = step;
+    }
+    else if (step * 2 > period * 3)
+    {
+        uint32_t missed = (step + period / 2) / period - 1;
+        uart_stats.ubx_rawx_gaps++;
+        uart_stats.ubx_rawx_missed += missed;
+        ESP_LOGW(TAG, "RXM-RAWX gap of %lld ms, %lu epochs missed", step, missed);
+    }
+}
+
+// true once, when the last of the epoch's PVT, DOP and HPPOSLLH arrived
+static bool ubx_epoch_add(uint32_t itow, uint8_t msg)
+{
+    if (itow != ubx_epoch_itow)
+    {
+        ubx_epoch_itow = itow;
+        ubx_epoch_seen = 0;
+    }
+
+    uint8_t seen = ubx_epoch_seen;
+    ubx_epoch_seen |= msg;
+    return seen != UBX_EPOCH_ALL && ubx_epoch_seen == UBX_EPOCH_ALL;
+}
+
+static void uart_status_pvt_position(const ubx_nav_pvt_t* pvt, status_gnss_t* gnss)
+{
+    gnss->lat = pvt->lat * 100LL;
+    gnss->lon = pvt->lon * 100LL;
+    gnss->hmsl = pvt->hmsl * 10;
+    gnss->geoid_sep = (pvt->height - pvt->hmsl) * 10;
+    gnss->sigma_lat = pvt->hacc;
+    gnss->sigma_lon = pvt->hacc;
+    gnss->sigma_alt = pvt->vacc;
+}
+
+static void uart_status_ubx(const uint8_t* msg, size_t len, status_gnss_t* gnss)
+{
+    ubx_nav_pvt_t pvt;
+    ubx_nav_dop_t dop;
+    ubx_nav_hpposllh_t pos;
+    ubx_nav_svin_t svin;
+    ubx_nav_sat_t sat;
+    char gga[UART_STATUS_GGA_LEN];
+    size_t gga_len;
+    bool surveyed = false;
+    bool epoch_done = false;
+
+    if (msg[2] == UBX_CLS_ACK)
+    {
+        ubx_ack(msg, len);
+        return;
+    }
+
+    if (msg[2] == UBX_CLS_CFG && msg[3] == UBX_ID_CFG_VALGET)
+    {
+        ubx_valget_answer(msg, len);
+        return;
+    }
+
+    if (msg[2] == UBX_CLS_RXM)
+    {
+        ubx_raw_capture(msg, len);
+        return;
+    }
+
+    if (msg[2] != UBX_CLS_NAV)
+    {
+        return;
+    }
+
+    switch (msg[3])
+    {
+        case UBX_ID_NAV_PVT:
+            if (!ubx_decode_nav_pvt(msg, len, &pvt))
+                return;
+            gnss->utc_ms = ((pvt.hour * 60 + pvt.min) * 60 + pvt.sec) * 1000 + pvt.nano / 1000000;
+            // carrier solution wins over differential, which wins over a plain fix
+            if (!(pvt.flags & 0x01) || pvt.fix_type < 2 || pvt.fix_type > 4)
+                gnss->quality = 0;
+            else if ((pvt.flags >> 6) == 2)
+                gnss->quality = 4;
+            else if ((pvt.flags >> 6) == 1)
+                gnss->quality = 5;
+            else if (pvt.flags & 0x02)
+                gnss->quality = 2;
+            else
+                gnss->quality = 1;
+            gnss->num_sv = pvt.num_sv;
+            ubx_epoch_pvt = pvt;
+            if (!ubx_position_hp)
+            {
+                uart_status_pvt_position(&pvt, gnss);
+            }
+            epoch_done = ubx_epoch_add(pvt.itow, UBX_EPOCH_PVT);
+            break;
+
+        case UBX_ID_NAV_DOP:
+            // GGA carries HDOP, NAV-PVT only has PDOP
+            if (!ubx_decode_nav_dop(msg, len, &dop))
+                return;
+            gnss->dop = dop.hdop;
+            epoch_done = ubx_epoch_add(dop.itow, UBX_EPOCH_DOP);
+            break;
+
+        case UBX_ID_NAV_HPPOSLLH:
+            if (!ubx_decode_nav_hpposllh(msg, len, &pos))
+                return;
+            epoch_done = ubx_epoch_add(pos.itow, UBX_EPOCH_HPPOSLLH);
+            ubx_position_hp = !pos.invalid;
+            if (pos.invalid)
+            {
+                // NAV-PVT of this epoch may have come first and left the position alone
+                if (ubx_epoch_seen & UBX_EPOCH_PVT)
+                {
+                    uart_status_pvt_position(&ubx_epoch_pvt, gnss);
+                }
+                break;
+            }
+            gnss->lat = pos.lat * 100LL + pos.lat_hp;
+            gnss->lon = pos.lon * 100LL + pos.lon_hp;
+            gnss->hmsl = pos.hmsl * 10 + pos.hmsl_hp;
+            gnss->geoid_sep = (pos.height * 10 + pos.height_hp) - gnss->hmsl;
+            gnss->sigma_lat = pos.hacc / 10;
+            gnss->sigma_lon = pos.hacc / 10;
+            gnss->sigma_alt = pos.vacc / 10;
+            break;
+
+        case UBX_ID_NAV_SVIN:
+            if (!ubx_decode_nav_svin(msg, len, &svin))
+                return;
+            // the receiver ends a survey by itself once both the duration and the accuracy limits are met
+            surveyed = gnss->svin_active && !svin.active && svin.valid;
+            gnss->svin_active = svin.active;
+            gnss->svin_valid = svin.valid;
+            gnss->svin_dur = svin.dur;
+            gnss->svin_acc = svin.mean_acc;
+            gnss->svin_obs = svin.obs;
+            gnss->svin_x = svin.mean_x * 100LL + svin.mean_x_hp;
+            gnss->svin_y = svin.mean_y * 100LL + svin.mean_y_hp;
+            gnss->svin_z = svin.mean_z * 100LL + svin.mean_z_hp;
+            ubx_survey_progress(&svin);
+            break;
+
+        case UBX_ID_NAV_SAT:
+            if (!ubx_decode_nav_sat(msg, len, &sat))
+                return;
+            gnss->sat_tracked = sat.num_svs;
+            gnss->cno_avg = sat.cno_avg;
+            break;
+
+        default:
+            return;
+    }
+
+    gnss->updated = esp_timer_get_time();
+    status_gnss_set(gnss);
+
+    // after status_gnss_set, so handlers read the final mean position
+    if (surveyed)
+    {
+        ESP_LOGI(TAG, "Survey-in done: %lu s, %lu observations, accuracy %lu.%lu mm", svin.dur, svin.obs, svin.mean_acc / 10, svin.mean_acc % 10);
+        esp_event_post(UART_STATUS_EVENT_SURVEY, 0, NULL, 0, portMAX_DELAY);
+    }
+
+    // one GGA per navigation epoch, from its own PVT, DOP and HPPOSLLH, only if it is uploaded somewhere
+    if (epoch_done && uart_status_read_handlers > 0)
+    {
+        gga_len = nmea_gga_print(gnss, gga, sizeof(gga));
+        if (gga_len > 0)
+        {
+            esp_event_post(UART_STATUS_EVENT_READ, gga_len /* use len as event ID */, gga, gga_len, portMAX_DELAY);
+        }
+    }
+}
+
 static void uart_status_task(void* ctx)
 {
-    char* buffer = calloc(UART_STATUS_BUFFER_LEN, sizeof(char));
-    int32_t len;
-    char* ptr;
+    nmea_splitter_t splitter;
+    status_gnss_t gnss = {0};
+    uart_event_t event;
+    const char* data;
+    char* space;
+    size_t space_len;
+    size_t available;
+    size_t len;
+    nmea_split_t type;
+    int32_t n;
+    int64_t now;
+    int64_t window_start = esp_timer_get_time();
+    uint32_t window_bytes = 0;
+    uint32_t window_wakeups = 0;
+
+    ESP_ERROR_CHECK(nmea_splitter_init(&splitter, UART_STATUS_LINE_BUFFER_LEN));
 
     ESP_LOGI(TAG, "Start uart_status_task");
     uart_flush_input(UART_STATUS_PORT);
+    xQueueReset(uart_status_queue);
     while (true)
     {
-        // read a line
-        ptr = buffer;
-        while (1)
+        // wake up on RX FIFO full or RX timeout, UBX messages do not end with '\n'
+        if (xQueueReceive(uart_status_queue, &event, portMAX_DELAY) != pdTRUE)
         {
-            if (uart_read_bytes(UART_STATUS_PORT, ptr, 1, portMAX_DELAY) == 1)
+            continue;
+        }
+        uart_stats.status_events++;
+
+        if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL)
+        {
+            ESP_LOGW(TAG, "UART_STATUS overflow");
+            uart_flush_input(UART_STATUS_PORT);
+            xQueueReset(uart_status_queue);
+            nmea_splitter_reset(&splitter);
+            uart_stats.status_overflows++;
+            continue;
+        }
+
+        if (event.type != UART_DATA)
+        {
+            continue;
+        }
+
+        // drain all buffered messages
+        available = 0;
+        uart_get_buffered_data_len(UART_STATUS_PORT, &available);
+        if (available == 0)
+        {
+            continue;
+        }
+
+        // bytes arrive at line rate, so the backlog tells how long the oldest one waited for this wakeup
+        uart_stats.status_wakeups++;
+        uart_stats.status_wait_us_max = MAX(uart_stats.status_wait_us_max, (uint32_t)(available * 10ULL * 1000000 / MAX(uart_stats.status_baud, 1)));
+
+        while (available > 0)
+        {
+            space = nmea_splitter_space(&splitter, &space_len);
+            n = uart_read_bytes(UART_STATUS_PORT, space, MIN(available, space_len), 0);
+            if (n <= 0)
             {
-                if (*ptr == '\n')
+                break;
+            }
+            available -= n;
+            uart_stats.status_bytes += n;
+
+            nmea_splitter_commit(&splitter, n);
+            while ((type = nmea_splitter_next(&splitter, &data, &len)) != NMEA_SPLIT_NONE)
+            {
+                if (type == NMEA_SPLIT_UBX)
                 {
-                    *ptr = 0;
-                    break;
+                    uart_stats.status_ubx++;
+                    // NAV-PVT opens a navigation epoch, the previous one is complete in the log buffer
+                    if (data[2] == UBX_CLS_NAV && data[3] == UBX_ID_NAV_PVT)
+                    {
+                        sdlog_epoch(SDLOG_UBX);
+                    }
+                    sdlog_write(data[2] == UBX_CLS_RXM ? SDLOG_RAWX : SDLOG_UBX, (const uint8_t*)data, len);
+                    uart_status_ubx((const uint8_t*)data, len, &gnss);
+                }
+                else
+                {
+                    uart_stats.status_lines++;
+                    uart_status_line(data, len, &gnss);
                 }
-                ptr++;
             }
         }
 
-        // replace '\r' by '\0'
-        len = ptr - buffer - 1;
-        buffer[len] = '\0';
+        uart_stats.status_ubx_errors = splitter.ubx_errors;
 
-        //  if a GGA or GST message
-        if (len > 5 && buffer[0] == '$')
+        // UART_STATUS budget, bytes on the wire against what the rate can carry
+        now = esp_timer_get_time();
+        if (now - window_start >= UART_RATE_WINDOW_MS * 1000LL)
         {
-            if (buffer[3] == 'G' && buffer[4] == 'G' && buffer[5] == 'A')
-            {
-                status_set(STATUS_GNSS_GGA, buffer);
-                esp_event_post(UART_STATUS_EVENT_READ, len /* use len as event ID */, buffer, len, portMAX_DELAY);
-            }
-            else if (buffer[3] == 'G' && buffer[4] == 'S' && buffer[5] == 'T')
+            uint32_t load = uart_stats.status_load;
+            uart_stats.status_bytes_per_s = (uart_stats.status_bytes - window_bytes) * 1000000ULL / (now - window_start);
+            uart_stats.status_wakeups_per_s = (uart_stats.status_wakeups - window_wakeups) * 1000000ULL / (now - window_start);
+            // 10 bits per byte on the wire: start, 8 data, stop
+            uart_stats.status_load = uart_stats.status_bytes_per_s * 10ULL * 100 / MAX(uart_stats.status_baud, 1);
+            uart_stats.status_load_max = MAX(uart_stats.status_load_max, uart_stats.status_load);
+            if (uart_stats.status_load >= UART_STATUS_LOAD_WARN && load < UART_STATUS_LOAD_WARN)
             {
-                status_set(STATUS_GNSS_GST, buffer);
+                ESP_LOGW(TAG, "UART_STATUS at %lu%% of %lu baud", uart_stats.status_load, uart_stats.status_baud);
             }
+            window_start = now;
+            window_bytes = uart_stats.status_bytes;
+            window_wakeups = uart_stats.status_wakeups;
         }
+    }
+}
+
+static void uart_rtcm3_publish(const uint8_t* data, size_t len, int64_t received)
+{
+    static bool published = false;
+    if (!published)
+    {
+        boot_mark(BOOT_FIRST_RTCM3);
+        published = true;
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    // copy once into a shared buffer, consumers take references instead of copies
+    rtcm3_buffer_t* buffer = rtcm3_pool_acquire();
+    if (buffer == NULL)
+    {
+        return;
     }
+
+    memcpy(buffer->data, data, len);
+    buffer->len = len;
+    buffer->received = received;
+    rtcm3_pool_publish(buffer);
 }
 
 static void uart_rtcm3_task(void* ctx)
 {
-    char* buffer = calloc(UART_STATUS_BUFFER_LEN, sizeof(char));
-    int32_t len;
+    rtcm3_framer_t framer;
+    uart_event_t event;
+    const uint8_t* frame;
+    uint8_t* space;
+    size_t space_len;
+    size_t available;
+    size_t len;
+    int64_t received;
+    uint32_t epoch_bytes = 0;
+    int32_t n;
+    int64_t now;
+    int64_t window_start = esp_timer_get_time();
+    uint32_t window_wakeups = 0;
+
+    ESP_ERROR_CHECK(rtcm3_framer_init(&framer, UART_RTCM3_BUFFER_LEN));
+    framer.crc_error = rtcm3_stats_crc_error;
+    rtcm3_msm_reset(&uart_rtcm3_msm);
 
     ESP_LOGI(TAG, "Start uart_rtcm3_task");
     uart_flush_input(UART_RTCM3_PORT);
+    xQueueReset(uart_rtcm3_queue);
     while (true)
     {
-        len = uart_read_bytes(UART_RTCM3_PORT, buffer, UART_STATUS_BUFFER_LEN, pdMS_TO_TICKS(500));
-        if (len > 0)
+        // wake up on RX FIFO full or RX timeout, idle links are kept alive by the consumers
+        if (xQueueReceive(uart_rtcm3_queue, &event, portMAX_DELAY) != pdTRUE)
         {
-            esp_event_post(UART_RTCM3_EVENT_READ, len /* use len as event ID */, buffer, len, portMAX_DELAY);
+            continue;
         }
-        else  // keep sockets alive
+        uart_stats.rtcm3_events++;
+
+        if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL)
         {
-            esp_event_post(UART_RTCM3_EVENT_READ, 4, "GNSS", 4, portMAX_DELAY);
+            ESP_LOGW(TAG, "UART_RTCM3 overflow");
+            uart_flush_input(UART_RTCM3_PORT);
+            xQueueReset(uart_rtcm3_queue);
+            rtcm3_framer_reset(&framer);
+            uart_stats.rtcm3_overflows++;
+            continue;
+        }
+
+        if (event.type != UART_DATA)
+        {
+            continue;
+        }
+
+        // a previous wakeup may have drained this data already
+        available = 0;
+        uart_get_buffered_data_len(UART_RTCM3_PORT, &available);
+        if (available == 0)
+        {
+            uart_stats.rtcm3_empty_wakeups++;
+            continue;
+        }
+
+        // bytes arrive at line rate, so the backlog tells how long the oldest one waited for this wakeup
+        uart_stats.rtcm3_wakeups++;
+        uart_stats.rtcm3_wait_us = available * 10ULL * 1000000 / MAX(uart_stats.rtcm3_baud, 1);
+        uart_stats.rtcm3_wait_us_max = MAX(uart_stats.rtcm3_wait_us_max, uart_stats.rtcm3_wait_us);
+
+        while (available > 0)
+        {
+            space = rtcm3_framer_space(&framer, &space_len);
+            n = uart_read_bytes(UART_RTCM3_PORT, space, MIN(available, space_len), 0);
+            if (n <= 0)
+            {
+                break;
+            }
+            received = esp_timer_get_time();
+            available -= n;
+            uart_stats.rtcm3_bytes += n;
+
+            rtcm3_framer_commit(&framer, n);
+
+            // only publish whole, validated frames
+            while (rtcm3_framer_next(&framer, &frame, &len))
+            {
+                rtcm3_stats_frame(frame, len);
+                uart_rtcm3_publish(frame, len, received);
+
+                // an epoch ends with the MSM that has the multiple message bit cleared
+                epoch_bytes += len;
+                if (rtcm3_is_msm(rtcm3_msg_type(frame)) && !rtcm3_msm_multiple(frame))
+                {
+                    uart_stats.rtcm3_epoch_bytes = epoch_bytes;
+                    uart_stats.rtcm3_epoch_bytes_max = MAX(uart_stats.rtcm3_epoch_bytes_max, epoch_bytes);
+                    epoch_bytes = 0;
+                }
+
+                // satellites and signals for the sky view, published once per epoch
+                if (rtcm3_msm_decode(&uart_rtcm3_msm, frame, len))
+                {
+                    status_sky_set(&uart_rtcm3_msm.sky);
+                }
+            }
+        }
+
+        uart_stats.rtcm3_frames = framer.frames;
+        uart_stats.rtcm3_crc_errors = framer.crc_errors;
+        uart_stats.rtcm3_skipped = framer.skipped;
+        uart_stats.rtcm3_msm_layouts = uart_rtcm3_msm.layout_changes;
+        uart_stats.rtcm3_msm_errors = uart_rtcm3_msm.errors;
+
+        now = esp_timer_get_time();
+        if (now - window_start >= UART_RATE_WINDOW_MS * 1000LL)
+        {
+            uart_stats.rtcm3_wakeups_per_s = (uart_stats.rtcm3_wakeups - window_wakeups) * 1000000ULL / (now - window_start);
+            window_start = now;
+            window_wakeups = uart_stats.rtcm3_wakeups;
         }
     }
 }
 
+static bool uart_rtcm3_probe()
+{
+    uint8_t* buffer = calloc(UART_RTCM3_BAUD_PROBE_LEN, sizeof(uint8_t));
+    int64_t deadline = esp_timer_get_time() + UART_RTCM3_BAUD_PROBE_MS * 1000LL;
+    size_t len = 0;
+    uint32_t n;
+    bool found = false;
+
+    // poll MON-VER on UART2 itself, only a clean reply at the new rate proves both sides match
+    uart_flush_input(UART_RTCM3_PORT);
+    n = ubx_gen_poll(UBX_CLS_MON, UBX_ID_VER, buffer);
+    uart_write_bytes(UART_RTCM3_PORT, buffer, n);
+
+    while (!found && len < UART_RTCM3_BAUD_PROBE_LEN && esp_timer_get_time() < deadline)
+    {
+        int32_t read = uart_read_bytes(UART_RTCM3_PORT, buffer + len, UART_RTCM3_BAUD_PROBE_LEN - len, pdMS_TO_TICKS(20));
+        if (read > 0)
+        {
+            len += read;
+            found = ubx_find_msg(buffer, len, UBX_CLS_MON, UBX_ID_VER) >= 0;
+        }
+    }
+
+    free(buffer);
+    return found;
+}
+
+static void uart_rtcm3_set_baud(uint32_t baud)
+{
+    uint8_t buffer[UBX_VALSET_LEN(1)];
+    ubx_valset_t valset;
+
+    // the receiver switches as soon as it applies the command, its ACK tells when the ESP side can follow
+    ubx_valset_begin(&valset, buffer, sizeof(buffer), UBX_LAYER_RAM);
+    ubx_valset_add_u4(&valset, UBX_KEY_UART2_BAUDRATE, baud);
+    ubx_valset_sync(&valset);
+
+    uart_set_baudrate(UART_RTCM3_PORT, baud);
+    uart_stats.rtcm3_baud = baud;
+}
+
+static void uart_rtcm3_upgrade_baud()
+{
+    char* target = config_get(CONFIG_RTCM3_BAUD);
+    uint32_t max_baud = strlen(target) > 0 ? (uint32_t)atoi(target) : UART_RTCM3_BAUD_DEFAULT;
+    bool upgraded = false;
+    uint8_t buffer[UBX_VALSET_LEN(1)];
+    ubx_valset_t valset;
+
+    uart_stats.rtcm3_baud = UART_RTCM3_CONFIG.baud_rate;
+
+    // UBX output is only needed on UART2 while probing
+    ubx_valset_begin(&valset, buffer, sizeof(buffer), UBX_LAYER_RAM);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART2OUTPROT_UBX, 1);
+    ubx_valset_sync(&valset);
+
+    for (size_t i = 0; i < sizeof(UART_RTCM3_BAUDS) / sizeof(UART_RTCM3_BAUDS[0]) && !upgraded; i++)
+    {
+        if (UART_RTCM3_BAUDS[i] > max_baud)
+        {
+            continue;
+        }
+
+        uart_rtcm3_set_baud(UART_RTCM3_BAUDS[i]);
+        upgraded = uart_rtcm3_probe();
+        ESP_LOGI(TAG, "UART_RTCM3 at %lu baud: %s", UART_RTCM3_BAUDS[i], upgraded ? "OK" : "no reply");
+    }
+
+    // fall back to the rate both sides start with
+    if (!upgraded && uart_stats.rtcm3_baud != UART_RTCM3_CONFIG.baud_rate)
+    {
+        uart_rtcm3_set_baud(UART_RTCM3_CONFIG.baud_rate);
+        ESP_LOGW(TAG, "UART_RTCM3 stays at %lu baud", uart_stats.rtcm3_baud);
+    }
+
+    ubx_valset_begin(&valset, buffer, sizeof(buffer), UBX_LAYER_RAM);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART2OUTPROT_UBX, 0);
+    ubx_valset_sync(&valset);
+}
+
+// the receiver may still be starting after power on, poll it instead of waiting a fixed time
+static bool ubx_wait_ready()
+{
+    uint8_t poll[8];
+    uint32_t len = ubx_gen_poll(UBX_CLS_MON, UBX_ID_VER, poll);
+    uint32_t seen = uart_stats.status_ubx;
+
+    for (int i = 0; i < UBX_READY_POLLS; i++)
+    {
+        uart_write_bytes(UART_STATUS_PORT, poll, len);
+        vTaskDelay(pdMS_TO_TICKS(UBX_READY_POLL_MS));
+        if (uart_stats.status_ubx != seen)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// both sides follow a new UART_STATUS rate, the link is proven by a MON-VER answer
+static esp_err_t uart_status_set_baud(uint32_t baud)
+{
+    uint8_t buffer[UBX_VALSET_LEN(1)];
+    ubx_valset_t valset;
+    uint32_t old = uart_stats.status_baud;
+    esp_err_t err = ESP_OK;
+
+    xSemaphoreTakeRecursive(ubx_cfg_lock, portMAX_DELAY);
+    uint32_t naks = uart_stats.ubx_naks;
+
+    ubx_valset_begin(&valset, buffer, sizeof(buffer), UBX_LAYER_RAM);
+    ubx_valset_add_u4(&valset, UBX_KEY_UART1_BAUDRATE, baud);
+    ubx_send_valset(&valset);
+
+    // the answer already comes at the new rate, follow as soon as the command left; a garbled ACK only times out
+    uart_wait_tx_done(UART_STATUS_PORT, pdMS_TO_TICKS(UBX_ACK_TIMEOUT_MS));
+    uart_set_baudrate(UART_STATUS_PORT, baud);
+    ubx_wait_ack(naks);
+
+    if (ubx_wait_ready())
+    {
+        uart_stats.status_baud = baud;
+        uart_stats.status_load_max = 0;
+    }
+    else
+    {
+        // the receiver kept its rate
+        uart_set_baudrate(UART_STATUS_PORT, old);
+        ERROR_IF(!ubx_wait_ready(), , "No answer from the receiver on UART_STATUS at %lu or %lu baud", baud, old);
+        err = ESP_ERR_TIMEOUT;
+    }
+
+    xSemaphoreGiveRecursive(ubx_cfg_lock);
+    ESP_LOGI(TAG, "UART_STATUS at %lu baud", uart_stats.status_baud);
+    return err;
+}
+
+static esp_err_t ubx_apply_raw_capture(bool enable)
+{
+    uint8_t buffer[UBX_VALSET_LEN(2)];
+    ubx_valset_t valset;
+    esp_err_t err = ESP_OK;
+
+    xSemaphoreTakeRecursive(ubx_cfg_lock, portMAX_DELAY);
+
+    // the rate goes up before the raw output starts, and down after it stopped
+    if (enable && uart_stats.status_baud != UART_STATUS_BAUD_RAW)
+    {
+        err = uart_status_set_baud(UART_STATUS_BAUD_RAW);
+    }
+
+    if (err == ESP_OK)
+    {
+        ubx_rawx_restart = true;
+        ubx_valset_begin(&valset, buffer, sizeof(buffer), UBX_LAYER_RAM);
+        ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_UBX_RXM_RAWX_UART1, enable);
+        ubx_valset_add_u1(&valset, UBX_KEY_MSGOUT_UBX_RXM_SFRBX_UART1, enable);
+        err = ubx_valset_sync(&valset);
+    }
+
+    if (err == ESP_OK)
+    {
+        uart_stats.ubx_raw_capture = enable;
+        if (!enable && uart_stats.status_baud != UART_STATUS_CONFIG.baud_rate)
+        {
+            err = uart_status_set_baud(UART_STATUS_CONFIG.baud_rate);
+        }
+    }
+
+    xSemaphoreGiveRecursive(ubx_cfg_lock);
+    ESP_LOGI(TAG, "UBX raw capture %s: %s", enable ? "on" : "off", esp_err_to_name(err));
+    return err;
+}
+
+static void ubx_mode_task(void* ctx)
+{
+    ubx_mode_job_t job;
+    uint64_t tmode;
+
+    while (true)
+    {
+        if (xQueueReceive(ubx_mode_queue, &job, portMAX_DELAY) != pdTRUE)
+        {
+            continue;
+        }
+
+        int64_t start = esp_timer_get_time();
+        ubx_mode_progress(&job, "applying");
+
+        // done once the receiver acknowledged the change, reads back the new TMODE or answers at the new rate, no fixed settle time
+        xSemaphoreTakeRecursive(ubx_cfg_lock, portMAX_DELAY);
+        uint32_t naks = uart_stats.ubx_naks;
+        esp_err_t err;
+        switch (job.kind)
+        {
+            case UBX_JOB_PROFILE:
+                if (job.profile_auto)
+                {
+                    // a client change queued before a fixed profile was set has nothing to do
+                    ubx_profile_update_queued = false;
+                    if (job.profile == NULL && !ubx_profile_auto)
+                    {
+                        err = ESP_OK;
+                        break;
+                    }
+
+                    // pick with the clients of now, an unchanged profile is not sent again
+                    job.profile = ubx_select_profile();
+                    ubx_profile_auto = true;
+                    if (job.profile == ubx_profile)
+                    {
+                        err = ESP_OK;
+                        break;
+                    }
+                }
+                else
+                {
+                    ubx_profile_auto = false;
+                }
+                ubx_apply_profile(job.profile);
+                err = ubx_wait_ack(naks);
+                break;
+            case UBX_JOB_RAW_CAPTURE:
+                err = ubx_apply_raw_capture(job.raw_capture);
+                break;
+            default:
+                ubx_write_valset(job.msg, job.len);
+                err = ubx_wait_ack(naks);
+                if (err == ESP_OK)
+                {
+                    ubx_mode_progress(&job, "acknowledged");
+                    err = ubx_valget(UBX_KEY_TMODE_MODE, &tmode);
+                    if (err == ESP_OK && tmode != job.tmode)
+                    {
+                        err = ESP_ERR_INVALID_STATE;
+                    }
+                }
+                break;
+        }
+        xSemaphoreGiveRecursive(ubx_cfg_lock);
+
+        uart_stats.ubx_mode_us = esp_timer_get_time() - start;
+        ESP_LOGI(TAG, "UBX mode %s (job %lu): %s in %lu us", job.mode, job.id, esp_err_to_name(err), uart_stats.ubx_mode_us);
+
+        switch (err)
+        {
+            case ESP_OK:
+                if (job.kind == UBX_JOB_MODE)
+                {
+                    status_set(STATUS_GNSS_MODE, job.mode);
+                }
+                ubx_mode_progress(&job, "done");
+                break;
+            case ESP_FAIL:
+                ubx_mode_progress(&job, "failed:nak");
+                break;
+            case ESP_ERR_TIMEOUT:
+                ubx_mode_progress(&job, "failed:timeout");
+                break;
+            default:
+                ubx_mode_progress(&job, "failed:readback");
+                break;
+        }
+    }
+}
+
+uint32_t ubx_set_raw_capture(bool enable)
+{
+    ubx_mode_job_t job;
+
+    // the rate change and the receiver's answers take seconds, not for the httpd task
+    job.kind = UBX_JOB_RAW_CAPTURE;
+    job.mode = enable ? "raw_capture_on" : "raw_capture_off";
+    job.tmode = 0;
+    job.raw_capture = enable;
+    job.len = 0;
+    return ubx_mode_queue_job(&job);
+}
+
 esp_err_t uart_init()
 {
     esp_err_t err = ESP_OK;
 
+    ubx_cfg_lock = xSemaphoreCreateRecursiveMutex();
+    ERROR_IF(ubx_cfg_lock == NULL, return ESP_ERR_NO_MEM, "Cannot create UBX config lock");
+    ubx_ack_signal = xSemaphoreCreateBinary();
+    ERROR_IF(ubx_ack_signal == NULL, return ESP_ERR_NO_MEM, "Cannot create UBX ACK signal");
+    ubx_valget_signal = xSemaphoreCreateBinary();
+    ERROR_IF(ubx_valget_signal == NULL, return ESP_ERR_NO_MEM, "Cannot create UBX CFG-VALGET signal");
+    ubx_mode_queue = xQueueCreate(UBX_MODE_QUEUE_LEN, sizeof(ubx_mode_job_t));
+    ERROR_IF(ubx_mode_queue == NULL, return ESP_ERR_NO_MEM, "Cannot create UBX mode queue");
+
     /*
      * start UART_STATUS port
      */
@@ -375,14 +1532,43 @@ esp_err_t uart_init()
     err = uart_param_config(UART_STATUS_PORT, &UART_STATUS_CONFIG);
     // assign pins for TX, RX; do not use RTS, CTS
     err = uart_set_pin(UART_STATUS_PORT, UART_STATUS_PIN_TX, UART_STATUS_PIN_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-    // start driver, RX buffer = UART_STATUS_BUFFER_LEN, no TX  buffer, no UART queue, no UART event
-    err = uart_driver_install(UART_STATUS_PORT, UART_STATUS_BUFFER_LEN, 0, 0, NULL, 0);
+    // start driver, RX buffer = UART_STATUS_BUFFER_LEN, no TX  buffer, with UART event queue
+    err = uart_driver_install(UART_STATUS_PORT, UART_STATUS_BUFFER_LEN, 0, UART_QUEUE_LEN, &uart_status_queue, 0);
     ERROR_IF(err != ESP_OK, return ESP_FAIL, "Cannot start UART_STATUS");
-
-    vTaskDelay(pdMS_TO_TICKS(1000));
+    // post an event when the RX FIFO is nearly full, or shortly after a burst ends
+    err = uart_set_rx_full_threshold(UART_STATUS_PORT, UART_STATUS_RX_FULL_THRESH);
+    ERROR_IF(err != ESP_OK, return ESP_FAIL, "Cannot set RX full threshold on UART_STATUS");
+    err = uart_set_rx_timeout(UART_STATUS_PORT, UART_STATUS_RX_TIMEOUT);
+    ERROR_IF(err != ESP_OK, return ESP_FAIL, "Cannot set RX timeout on UART_STATUS");
+
+    // the reader counts the ACKs of the configuration below
+    uart_stats.status_baud = UART_STATUS_CONFIG.baud_rate;
+    xTaskCreate(uart_status_task, "uart_status", UART_STATUS_TASK_STACK, NULL, 10, NULL);
+
+    boot_begin(BOOT_UBX_READY);
+    bool ready = ubx_wait_ready();
+    if (!ready)
+    {
+        // an ESP reset during a raw capture leaves the receiver at the capture rate
+        uart_set_baudrate(UART_STATUS_PORT, UART_STATUS_BAUD_RAW);
+        uart_stats.status_baud = UART_STATUS_BAUD_RAW;
+        ready = ubx_wait_ready() && uart_status_set_baud(UART_STATUS_CONFIG.baud_rate) == ESP_OK;
+        if (!ready)
+        {
+            uart_set_baudrate(UART_STATUS_PORT, UART_STATUS_CONFIG.baud_rate);
+            uart_stats.status_baud = UART_STATUS_CONFIG.baud_rate;
+        }
+    }
+    boot_end(BOOT_UBX_READY);
+    ERROR_IF(!ready, , "No answer from the receiver on UART_STATUS");
 
     // initialize Ublox
+    boot_begin(BOOT_UBX_CONFIG);
     ubx_set_default();
+    boot_end(BOOT_UBX_CONFIG);
+
+    // mode changes from the web app are applied here, so the HTTP server never waits for the receiver
+    xTaskCreate(ubx_mode_task, "ubx_mode", 4096, NULL, 5, NULL);
 
     /*
      * start UART_RTCM3 port
@@ -392,16 +1578,23 @@ esp_err_t uart_init()
     err = uart_param_config(UART_RTCM3_PORT, &UART_RTCM3_CONFIG);
     // assign pins for TX, RX; do not use RTS, CTS
     err = uart_set_pin(UART_RTCM3_PORT, UART_RTCM3_PIN_TX, UART_RTCM3_PIN_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-    // start driver, RX buffer = UART_RTCM3_BUFFER_LEN, no TX  buffer, no UART queue, no UART event
-    err = uart_driver_install(UART_RTCM3_PORT, UART_RTCM3_BUFFER_LEN, 0, 0, NULL, 0);
+    // start driver, RX buffer = UART_RTCM3_BUFFER_LEN, no TX  buffer, with UART event queue
+    err = uart_driver_install(UART_RTCM3_PORT, UART_RTCM3_BUFFER_LEN, 0, UART_QUEUE_LEN, &uart_rtcm3_queue, 0);
     ERROR_IF(err != ESP_OK, return ESP_FAIL, "Cannot start UART_RTCM3");
+    // post an event when the RX FIFO is nearly full, or shortly after a burst ends
+    err = uart_set_rx_full_threshold(UART_RTCM3_PORT, UART_RTCM3_RX_FULL_THRESH);
+    ERROR_IF(err != ESP_OK, return ESP_FAIL, "Cannot set RX full threshold on UART_RTCM3");
+    err = uart_set_rx_timeout(UART_RTCM3_PORT, UART_RTCM3_RX_TIMEOUT);
+    ERROR_IF(err != ESP_OK, return ESP_FAIL, "Cannot set RX timeout on UART_RTCM3");
 
-    vTaskDelay(pdMS_TO_TICKS(1000));
+    // move UART2 to the fastest rate the link can hold, before the readers start
+    boot_begin(BOOT_RTCM3_BAUD);
+    uart_rtcm3_upgrade_baud();
+    boot_end(BOOT_RTCM3_BAUD);
 
     /*
-     * start reading tasks
+     * start reading task
      */
-    xTaskCreate(uart_status_task, "uart_status", 2 * UART_STATUS_BUFFER_LEN, NULL, 10, NULL);
     xTaskCreate(uart_rtcm3_task, "uart_rtcm3", 2 * UART_RTCM3_BUFFER_LEN, NULL, 10, NULL);
     return err;
 }
@@ -3,21 +3,75 @@
 
 #include <esp_err.h>
 #include <esp_event.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
-extern esp_event_base_t const UART_RTCM3_EVENT_READ;
 extern esp_event_base_t const UART_RTCM3_EVENT_WRITE;
 extern esp_event_base_t const UART_STATUS_EVENT_READ;
 extern esp_event_base_t const UART_STATUS_EVENT_WRITE;
+// posted once, without data, when a running survey-in meets its accuracy target; the result is in status_gnss_get
+extern esp_event_base_t const UART_STATUS_EVENT_SURVEY;
+
+typedef struct
+{
+    uint32_t status_wakeups;         // data events that carried new bytes
+    uint32_t status_lines;           // lines split from UART_STATUS
+    uint32_t status_nmea_errors;     // NMEA lines dropped on bad format or checksum
+    uint32_t status_ubx;             // UBX messages split from UART_STATUS
+    uint32_t status_ubx_errors;      // UBX headers dropped on bad length or checksum
+    uint32_t status_overflows;       // driver FIFO/buffer overflows on UART_STATUS
+    uint32_t status_baud;            // current UART_STATUS baud rate
+    uint32_t status_bytes;           // bytes read from UART_STATUS
+    uint32_t status_bytes_per_s;     // over the last second
+    uint32_t status_load;            // percent of the UART_STATUS rate used over the last second
+    uint32_t status_load_max;        // highest load since the rate was set
+    uint32_t status_events;          // driver events of any type
+    uint32_t status_wakeups_per_s;   // over the last second
+    uint32_t status_wait_us_max;     // longest time the oldest byte of a wakeup sat in the driver, from bytes buffered and baud rate
+    uint32_t rtcm3_wakeups;          // data events that carried new bytes
+    uint32_t rtcm3_empty_wakeups;    // data events for bytes already drained
+    uint32_t rtcm3_events;           // driver events of any type
+    uint32_t rtcm3_wakeups_per_s;    // over the last second
+    uint32_t rtcm3_wait_us;          // time the oldest byte of the last wakeup sat in the driver, from bytes buffered and baud rate
+    uint32_t rtcm3_wait_us_max;      // longest of those
+    uint32_t rtcm3_bytes;            // bytes read from UART_RTCM3
+    uint32_t rtcm3_frames;           // valid frames posted
+    uint32_t rtcm3_crc_errors;       // frames dropped on CRC mismatch
+    uint32_t rtcm3_skipped;          // bytes dropped while searching for a preamble
+    uint32_t rtcm3_overflows;        // driver FIFO/buffer overflows on UART_RTCM3
+    uint32_t rtcm3_baud;             // negotiated UART_RTCM3 baud rate
+    uint32_t rtcm3_epoch_bytes;      // bytes of the last complete MSM epoch
+    uint32_t rtcm3_epoch_bytes_max;  // largest MSM epoch seen
+    uint32_t rtcm3_msm_layouts;      // MSM satellite/signal masks that changed and were decoded again
+    uint32_t rtcm3_msm_errors;       // MSMs shorter than their masks
+    uint32_t ubx_valsets;            // CFG-VALSET messages sent on UART_STATUS
+    uint32_t ubx_acks;               // answered with ACK-ACK
+    uint32_t ubx_naks;               // answered with ACK-NAK
+    uint32_t ubx_ack_timeouts;       // waits that gave up on missing answers
+    uint32_t ubx_config_us;          // last default configuration, until every answer arrived
+    uint32_t ubx_mode_us;            // last mode switch, until the answer arrived
+    uint32_t ubx_raw_capture;        // 1 while RXM-RAWX and RXM-SFRBX are sent on UART_STATUS
+    uint32_t ubx_rawx;               // RXM-RAWX epochs
+    uint32_t ubx_sfrbx;              // RXM-SFRBX subframes
+    uint32_t ubx_rawx_period_ms;     // shortest step between RXM-RAWX epochs, the measurement period
+    uint32_t ubx_rawx_gaps;          // steps longer than one period
+    uint32_t ubx_rawx_missed;        // epochs lost in those steps
+} uart_stats_t;
 
 esp_err_t uart_init();
+size_t uart_stats_print(char* buffer, size_t len);
 
 void uart_register_handler(esp_event_base_t event_base, esp_event_handler_t event_handler);
 void uart_unregister_handler(esp_event_base_t event_base, esp_event_handler_t event_handler);
 
 void ubx_set_default();
-void ubx_set_mode_rover();
-void ubx_set_mode_survey(const char* dur, const char* acc);
-void ubx_set_mode_fixed(const char* lat, const char* lon, const char* alt);
+uint32_t ubx_set_profile(const char* name);
+void ubx_update_profile(int clients);
+uint32_t ubx_set_mode_rover();
+uint32_t ubx_set_mode_survey(const char* dur, const char* acc);
+uint32_t ubx_set_mode_fixed(const char* lat, const char* lon, const char* alt);
+uint32_t ubx_set_raw_capture(bool enable);
 void ubx_write_rtcm3(const char* buffer, size_t len);
 
 #endif  // ESP32S3_GNSS_UART_H
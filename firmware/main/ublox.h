@@ -1,8 +1,12 @@
 #ifndef ESP32S3_GNSS_UBLOX_H
 #define ESP32S3_GNSS_UBLOX_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+#include "ubx_keys.h"
+
 typedef enum
 {
     GNSS_MODE_ROVER = 0,
@@ -10,6 +14,162 @@ typedef enum
     GNSS_MODE_FIXED
 } gnss_mode_t;
 
+#define UBX_HEADER_LEN      6  // sync, class, id, length
+#define UBX_CHECKSUM_LEN    2
+#define UBX_PAYLOAD_LEN_MAX (16 + 32 * 255)  // RXM-RAWX with 255 measurements, the longest message
+#define UBX_MSG_LEN_MAX     (UBX_HEADER_LEN + UBX_PAYLOAD_LEN_MAX + UBX_CHECKSUM_LEN)
+
+#define UBX_CLS_NAV         0x01
+#define UBX_ID_NAV_DOP      0x04
+#define UBX_ID_NAV_PVT      0x07
+#define UBX_ID_NAV_HPPOSLLH 0x14
+#define UBX_ID_NAV_SAT      0x35
+#define UBX_ID_NAV_SVIN     0x3B
+#define UBX_CLS_RXM         0x02
+#define UBX_ID_RXM_SFRBX    0x13
+#define UBX_ID_RXM_RAWX     0x15
+#define UBX_CLS_ACK         0x05
+#define UBX_ID_ACK_NAK      0x00
+#define UBX_ID_ACK_ACK      0x01
+#define UBX_CLS_CFG         0x06
+#define UBX_ID_CFG_VALSET   0x8A
+#define UBX_ID_CFG_VALGET   0x8B
+#define UBX_CLS_MON         0x0A
+#define UBX_ID_VER          0x04
+
+// key value pairs in one CFG-VALSET, the receiver limit; a value is at most 8 bytes
+#define UBX_VALSET_KEYS_MAX  64
+#define UBX_VALSET_LEN(keys) (UBX_HEADER_LEN + 4 + (keys) * (4 + 8) + UBX_CHECKSUM_LEN)
+#define UBX_VALSET_LEN_MAX   UBX_VALSET_LEN(UBX_VALSET_KEYS_MAX)
+
+#define UBX_LAYER_RAM   0x01
+#define UBX_LAYER_BBR   0x02
+#define UBX_LAYER_FLASH 0x04
+
+// fields keep the units of the message
+typedef struct
+{
+    uint32_t itow;  // ms, GPS time of week
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t min;
+    uint8_t sec;
+    int32_t nano;       // ns, fraction of sec, may be negative
+    uint8_t fix_type;   // 0 no fix, 1 DR, 2 2D, 3 3D, 4 GNSS+DR, 5 time only
+    uint8_t flags;      // bit 0 gnssFixOK, bit 1 diffSoln, bits 6..7 carrSoln
+    uint8_t num_sv;     // satellites used
+    int32_t lon;        // 1e-7 deg
+    int32_t lat;        // 1e-7 deg
+    int32_t height;     // mm above ellipsoid
+    int32_t hmsl;       // mm above mean sea level
+    uint32_t hacc;      // mm
+    uint32_t vacc;      // mm
+    uint16_t pdop;      // 0.01
+} ubx_nav_pvt_t;
+
+typedef struct
+{
+    uint32_t itow;     // ms
+    bool invalid;      // invalidLlh
+    int32_t lon;       // 1e-7 deg
+    int32_t lat;       // 1e-7 deg
+    int32_t height;    // mm above ellipsoid
+    int32_t hmsl;      // mm above mean sea level
+    int8_t lon_hp;     // 1e-9 deg
+    int8_t lat_hp;     // 1e-9 deg
+    int8_t height_hp;  // 0.1 mm
+    int8_t hmsl_hp;    // 0.1 mm
+    uint32_t hacc;     // 0.1 mm
+    uint32_t vacc;     // 0.1 mm
+} ubx_nav_hpposllh_t;
+
+typedef struct
+{
+    uint32_t itow;      // ms
+    uint32_t dur;       // s, survey-in duration so far
+    int32_t mean_x;     // cm, ECEF
+    int32_t mean_y;     // cm
+    int32_t mean_z;     // cm
+    int8_t mean_x_hp;   // 0.1 mm
+    int8_t mean_y_hp;   // 0.1 mm
+    int8_t mean_z_hp;   // 0.1 mm
+    uint32_t mean_acc;  // 0.1 mm
+    uint32_t obs;       // positions used
+    bool valid;
+    bool active;
+} ubx_nav_svin_t;
+
+typedef struct
+{
+    uint32_t itow;  // ms
+    uint16_t gdop;  // 0.01
+    uint16_t pdop;  // 0.01
+    uint16_t tdop;  // 0.01
+    uint16_t vdop;  // 0.01
+    uint16_t hdop;  // 0.01
+    uint16_t ndop;  // 0.01
+    uint16_t edop;  // 0.01
+} ubx_nav_dop_t;
+
+// summary of the per-satellite blocks
+typedef struct
+{
+    uint32_t itow;  // ms
+    uint8_t num_svs;
+    uint8_t num_used;
+    uint8_t cno_max;  // dBHz
+    uint8_t cno_avg;  // dBHz, of the used satellites
+} ubx_nav_sat_t;
+
+// epoch header of the raw measurements, the per-signal blocks are left to post-processing
+typedef struct
+{
+    double rcv_tow;    // s, receiver time of week
+    uint16_t week;
+    int8_t leap_s;     // s, GPS - UTC
+    uint8_t num_meas;
+    uint8_t rec_stat;  // bit 0 leapSec valid, bit 1 clkReset
+} ubx_rxm_rawx_t;
+
+// CFG-VALSET written straight into a caller buffer, the checksum follows every value
+typedef struct
+{
+    uint8_t* buff;
+    size_t size;
+    size_t len;    // bytes written, header included
+    uint8_t keys;
+    uint8_t ck_a;  // of the key value pairs so far
+    uint8_t ck_b;
+    bool error;    // out of space, too many keys or a value of the wrong type
+} ubx_valset_t;
+
+ubx_key_t ubx_key_find(const char* name);
 uint32_t ubx_gen_cmd(const char* msg, uint8_t* buff);
+void ubx_valset_begin(ubx_valset_t* valset, uint8_t* buff, size_t size, uint8_t layers);
+void ubx_valset_transaction(ubx_valset_t* valset, uint8_t action);
+bool ubx_valset_add_u1(ubx_valset_t* valset, ubx_key_t key, uint8_t val);
+bool ubx_valset_add_u2(ubx_valset_t* valset, ubx_key_t key, uint16_t val);
+bool ubx_valset_add_u4(ubx_valset_t* valset, ubx_key_t key, uint32_t val);
+bool ubx_valset_add_u8(ubx_valset_t* valset, ubx_key_t key, uint64_t val);
+bool ubx_valset_add_i1(ubx_valset_t* valset, ubx_key_t key, int8_t val);
+bool ubx_valset_add_i2(ubx_valset_t* valset, ubx_key_t key, int16_t val);
+bool ubx_valset_add_i4(ubx_valset_t* valset, ubx_key_t key, int32_t val);
+bool ubx_valset_add_r4(ubx_valset_t* valset, ubx_key_t key, float val);
+bool ubx_valset_add_r8(ubx_valset_t* valset, ubx_key_t key, double val);
+uint32_t ubx_valset_end(ubx_valset_t* valset);
+uint32_t ubx_gen_valget(ubx_key_t key, uint8_t layer, uint8_t* buff);
+bool ubx_decode_cfg_valget(const uint8_t* buff, size_t len, ubx_key_t key, uint64_t* val);
+uint32_t ubx_gen_poll(uint8_t cls, uint8_t id, uint8_t* buff);
+int ubx_find_msg(const uint8_t* buff, size_t len, uint8_t cls, uint8_t id);
+bool ubx_check_msg(const uint8_t* buff, size_t len);
+bool ubx_decode_nav_pvt(const uint8_t* buff, size_t len, ubx_nav_pvt_t* pvt);
+bool ubx_decode_nav_dop(const uint8_t* buff, size_t len, ubx_nav_dop_t* dop);
+bool ubx_decode_nav_hpposllh(const uint8_t* buff, size_t len, ubx_nav_hpposllh_t* pos);
+bool ubx_decode_nav_svin(const uint8_t* buff, size_t len, ubx_nav_svin_t* svin);
+bool ubx_decode_nav_sat(const uint8_t* buff, size_t len, ubx_nav_sat_t* sat);
+bool ubx_decode_rxm_rawx(const uint8_t* buff, size_t len, ubx_rxm_rawx_t* rawx);
+uint32_t crc24q(const uint8_t* buff, size_t len);
 
 #endif  // ESP32S3_GNSS_UBLOX_H
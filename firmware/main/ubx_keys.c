@@ -0,0 +1,640 @@
+// generated by scripts/gen_ubx_keys.py from scripts/ubx_keys.csv, do not edit
+#include "ubx_keys.h"
+
+const ubx_key_info_t ubx_keys[UBX_KEY_COUNT] = {
+    [UBX_KEY_GEOFENCE_CONFLVL] = {"GEOFENCE-CONFLVL", 0x20240011, UBX_VAL_U1},
+    [UBX_KEY_GEOFENCE_FENCE1_LAT] = {"GEOFENCE-FENCE1_LAT", 0x40240021, UBX_VAL_I4},
+    [UBX_KEY_GEOFENCE_FENCE1_LON] = {"GEOFENCE-FENCE1_LON", 0x40240022, UBX_VAL_I4},
+    [UBX_KEY_GEOFENCE_FENCE1_RAD] = {"GEOFENCE-FENCE1_RAD", 0x40240023, UBX_VAL_U4},
+    [UBX_KEY_GEOFENCE_FENCE2_LAT] = {"GEOFENCE-FENCE2_LAT", 0x40240031, UBX_VAL_I4},
+    [UBX_KEY_GEOFENCE_FENCE2_LON] = {"GEOFENCE-FENCE2_LON", 0x40240032, UBX_VAL_I4},
+    [UBX_KEY_GEOFENCE_FENCE2_RAD] = {"GEOFENCE-FENCE2_RAD", 0x40240033, UBX_VAL_U4},
+    [UBX_KEY_GEOFENCE_FENCE3_LAT] = {"GEOFENCE-FENCE3_LAT", 0x40240041, UBX_VAL_I4},
+    [UBX_KEY_GEOFENCE_FENCE3_LON] = {"GEOFENCE-FENCE3_LON", 0x40240042, UBX_VAL_I4},
+    [UBX_KEY_GEOFENCE_FENCE3_RAD] = {"GEOFENCE-FENCE3_RAD", 0x40240043, UBX_VAL_U4},
+    [UBX_KEY_GEOFENCE_FENCE4_LAT] = {"GEOFENCE-FENCE4_LAT", 0x40240051, UBX_VAL_I4},
+    [UBX_KEY_GEOFENCE_FENCE4_LON] = {"GEOFENCE-FENCE4_LON", 0x40240052, UBX_VAL_I4},
+    [UBX_KEY_GEOFENCE_FENCE4_RAD] = {"GEOFENCE-FENCE4_RAD", 0x40240053, UBX_VAL_U4},
+    [UBX_KEY_GEOFENCE_PIN] = {"GEOFENCE-PIN", 0x20240014, UBX_VAL_U1},
+    [UBX_KEY_GEOFENCE_PINPOL] = {"GEOFENCE-PINPOL", 0x20240013, UBX_VAL_U1},
+    [UBX_KEY_GEOFENCE_USE_FENCE1] = {"GEOFENCE-USE_FENCE1", 0x10240020, UBX_VAL_U1},
+    [UBX_KEY_GEOFENCE_USE_FENCE2] = {"GEOFENCE-USE_FENCE2", 0x10240030, UBX_VAL_U1},
+    [UBX_KEY_GEOFENCE_USE_FENCE3] = {"GEOFENCE-USE_FENCE3", 0x10240040, UBX_VAL_U1},
+    [UBX_KEY_GEOFENCE_USE_FENCE4] = {"GEOFENCE-USE_FENCE4", 0x10240050, UBX_VAL_U1},
+    [UBX_KEY_GEOFENCE_USE_PIO] = {"GEOFENCE-USE_PIO", 0x10240012, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_CFG_OPENDET] = {"HW-ANT_CFG_OPENDET", 0x10a30031, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_CFG_OPENDET_POL] = {"HW-ANT_CFG_OPENDET_POL", 0x10a30032, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_CFG_PWRDOWN] = {"HW-ANT_CFG_PWRDOWN", 0x10a30033, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_CFG_PWRDOWN_POL] = {"HW-ANT_CFG_PWRDOWN_POL", 0x10a30034, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_CFG_RECOVER] = {"HW-ANT_CFG_RECOVER", 0x10a30035, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_CFG_SHORTDET] = {"HW-ANT_CFG_SHORTDET", 0x10a3002f, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_CFG_SHORTDET_POL] = {"HW-ANT_CFG_SHORTDET_POL", 0x10a30030, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_CFG_VOLTCTRL] = {"HW-ANT_CFG_VOLTCTRL", 0x10a3002e, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_SUP_OPEN_PIN] = {"HW-ANT_SUP_OPEN_PIN", 0x20a30038, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_SUP_SHORT_PIN] = {"HW-ANT_SUP_SHORT_PIN", 0x20a30037, UBX_VAL_U1},
+    [UBX_KEY_HW_ANT_SUP_SWITCH_PIN] = {"HW-ANT_SUP_SWITCH_PIN", 0x20a30036, UBX_VAL_U1},
+    [UBX_KEY_I2C_ADDRESS] = {"I2C-ADDRESS", 0x20510001, UBX_VAL_U1},
+    [UBX_KEY_I2C_ENABLED] = {"I2C-ENABLED", 0x10510003, UBX_VAL_U1},
+    [UBX_KEY_I2C_EXTENDEDTIMEOUT] = {"I2C-EXTENDEDTIMEOUT", 0x10510002, UBX_VAL_U1},
+    [UBX_KEY_I2CINPROT_NMEA] = {"I2CINPROT-NMEA", 0x10710002, UBX_VAL_U1},
+    [UBX_KEY_I2CINPROT_RTCM2X] = {"I2CINPROT-RTCM2X", 0x10710003, UBX_VAL_U1},
+    [UBX_KEY_I2CINPROT_RTCM3X] = {"I2CINPROT-RTCM3X", 0x10710004, UBX_VAL_U1},
+    [UBX_KEY_I2CINPROT_UBX] = {"I2CINPROT-UBX", 0x10710001, UBX_VAL_U1},
+    [UBX_KEY_I2COUTPROT_NMEA] = {"I2COUTPROT-NMEA", 0x10720002, UBX_VAL_U1},
+    [UBX_KEY_I2COUTPROT_RTCM3X] = {"I2COUTPROT-RTCM3X", 0x10720004, UBX_VAL_U1},
+    [UBX_KEY_I2COUTPROT_UBX] = {"I2COUTPROT-UBX", 0x10720001, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_NMEA_I2C] = {"INFMSG-NMEA_I2C", 0x20920006, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_NMEA_SPI] = {"INFMSG-NMEA_SPI", 0x2092000a, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_NMEA_UART1] = {"INFMSG-NMEA_UART1", 0x20920007, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_NMEA_UART2] = {"INFMSG-NMEA_UART2", 0x20920008, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_NMEA_USB] = {"INFMSG-NMEA_USB", 0x20920009, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_UBX_I2C] = {"INFMSG-UBX_I2C", 0x20920001, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_UBX_SPI] = {"INFMSG-UBX_SPI", 0x20920005, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_UBX_UART1] = {"INFMSG-UBX_UART1", 0x20920002, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_UBX_UART2] = {"INFMSG-UBX_UART2", 0x20920003, UBX_VAL_U1},
+    [UBX_KEY_INFMSG_UBX_USB] = {"INFMSG-UBX_USB", 0x20920004, UBX_VAL_U1},
+    [UBX_KEY_ITFM_ANTSETTING] = {"ITFM-ANTSETTING", 0x20410010, UBX_VAL_U1},
+    [UBX_KEY_ITFM_BBTHRESHOLD] = {"ITFM-BBTHRESHOLD", 0x20410001, UBX_VAL_U1},
+    [UBX_KEY_ITFM_CWTHRESHOLD] = {"ITFM-CWTHRESHOLD", 0x20410002, UBX_VAL_U1},
+    [UBX_KEY_ITFM_ENABLE] = {"ITFM-ENABLE", 0x1041000d, UBX_VAL_U1},
+    [UBX_KEY_ITFM_ENABLE_AUX] = {"ITFM-ENABLE_AUX", 0x10410013, UBX_VAL_U1},
+    [UBX_KEY_LOGFILTER_APPLY_ALL_FILTERS] = {"LOGFILTER-APPLY_ALL_FILTERS", 0x10de0004, UBX_VAL_U1},
+    [UBX_KEY_LOGFILTER_MIN_INTERVAL] = {"LOGFILTER-MIN_INTERVAL", 0x30de0005, UBX_VAL_U2},
+    [UBX_KEY_LOGFILTER_ONCE_PER_WAKE_UP_ENA] = {"LOGFILTER-ONCE_PER_WAKE_UP_ENA", 0x10de0003, UBX_VAL_U1},
+    [UBX_KEY_LOGFILTER_POSITION_THRS] = {"LOGFILTER-POSITION_THRS", 0x40de0008, UBX_VAL_U4},
+    [UBX_KEY_LOGFILTER_RECORD_ENA] = {"LOGFILTER-RECORD_ENA", 0x10de0002, UBX_VAL_U1},
+    [UBX_KEY_LOGFILTER_SPEED_THRS] = {"LOGFILTER-SPEED_THRS", 0x30de0007, UBX_VAL_U2},
+    [UBX_KEY_LOGFILTER_TIME_THRS] = {"LOGFILTER-TIME_THRS", 0x30de0006, UBX_VAL_U2},
+    [UBX_KEY_MOT_GNSSDIST_THRS] = {"MOT-GNSSDIST_THRS", 0x3025003b, UBX_VAL_U2},
+    [UBX_KEY_MOT_GNSSSPEED_THRS] = {"MOT-GNSSSPEED_THRS", 0x20250038, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_DTM_I2C] = {"MSGOUT-NMEA_ID_DTM_I2C", 0x209100a6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_DTM_SPI] = {"MSGOUT-NMEA_ID_DTM_SPI", 0x209100aa, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_DTM_UART1] = {"MSGOUT-NMEA_ID_DTM_UART1", 0x209100a7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_DTM_UART2] = {"MSGOUT-NMEA_ID_DTM_UART2", 0x209100a8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_DTM_USB] = {"MSGOUT-NMEA_ID_DTM_USB", 0x209100a9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GBS_I2C] = {"MSGOUT-NMEA_ID_GBS_I2C", 0x209100dd, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GBS_SPI] = {"MSGOUT-NMEA_ID_GBS_SPI", 0x209100e1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GBS_UART1] = {"MSGOUT-NMEA_ID_GBS_UART1", 0x209100de, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GBS_UART2] = {"MSGOUT-NMEA_ID_GBS_UART2", 0x209100df, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GBS_USB] = {"MSGOUT-NMEA_ID_GBS_USB", 0x209100e0, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GGA_I2C] = {"MSGOUT-NMEA_ID_GGA_I2C", 0x209100ba, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GGA_SPI] = {"MSGOUT-NMEA_ID_GGA_SPI", 0x209100be, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GGA_UART1] = {"MSGOUT-NMEA_ID_GGA_UART1", 0x209100bb, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GGA_UART2] = {"MSGOUT-NMEA_ID_GGA_UART2", 0x209100bc, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GGA_USB] = {"MSGOUT-NMEA_ID_GGA_USB", 0x209100bd, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GLL_I2C] = {"MSGOUT-NMEA_ID_GLL_I2C", 0x209100c9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GLL_SPI] = {"MSGOUT-NMEA_ID_GLL_SPI", 0x209100cd, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GLL_UART1] = {"MSGOUT-NMEA_ID_GLL_UART1", 0x209100ca, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GLL_UART2] = {"MSGOUT-NMEA_ID_GLL_UART2", 0x209100cb, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GLL_USB] = {"MSGOUT-NMEA_ID_GLL_USB", 0x209100cc, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GNS_I2C] = {"MSGOUT-NMEA_ID_GNS_I2C", 0x209100b5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GNS_SPI] = {"MSGOUT-NMEA_ID_GNS_SPI", 0x209100b9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GNS_UART1] = {"MSGOUT-NMEA_ID_GNS_UART1", 0x209100b6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GNS_UART2] = {"MSGOUT-NMEA_ID_GNS_UART2", 0x209100b7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GNS_USB] = {"MSGOUT-NMEA_ID_GNS_USB", 0x209100b8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GRS_I2C] = {"MSGOUT-NMEA_ID_GRS_I2C", 0x209100ce, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GRS_SPI] = {"MSGOUT-NMEA_ID_GRS_SPI", 0x209100d2, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GRS_UART1] = {"MSGOUT-NMEA_ID_GRS_UART1", 0x209100cf, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GRS_UART2] = {"MSGOUT-NMEA_ID_GRS_UART2", 0x209100d0, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GRS_USB] = {"MSGOUT-NMEA_ID_GRS_USB", 0x209100d1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSA_I2C] = {"MSGOUT-NMEA_ID_GSA_I2C", 0x209100bf, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSA_SPI] = {"MSGOUT-NMEA_ID_GSA_SPI", 0x209100c3, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSA_UART1] = {"MSGOUT-NMEA_ID_GSA_UART1", 0x209100c0, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSA_UART2] = {"MSGOUT-NMEA_ID_GSA_UART2", 0x209100c1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSA_USB] = {"MSGOUT-NMEA_ID_GSA_USB", 0x209100c2, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GST_I2C] = {"MSGOUT-NMEA_ID_GST_I2C", 0x209100d3, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GST_SPI] = {"MSGOUT-NMEA_ID_GST_SPI", 0x209100d7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GST_UART1] = {"MSGOUT-NMEA_ID_GST_UART1", 0x209100d4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GST_UART2] = {"MSGOUT-NMEA_ID_GST_UART2", 0x209100d5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GST_USB] = {"MSGOUT-NMEA_ID_GST_USB", 0x209100d6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSV_I2C] = {"MSGOUT-NMEA_ID_GSV_I2C", 0x209100c4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSV_SPI] = {"MSGOUT-NMEA_ID_GSV_SPI", 0x209100c8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSV_UART1] = {"MSGOUT-NMEA_ID_GSV_UART1", 0x209100c5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSV_UART2] = {"MSGOUT-NMEA_ID_GSV_UART2", 0x209100c6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_GSV_USB] = {"MSGOUT-NMEA_ID_GSV_USB", 0x209100c7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_RMC_I2C] = {"MSGOUT-NMEA_ID_RMC_I2C", 0x209100ab, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_RMC_SPI] = {"MSGOUT-NMEA_ID_RMC_SPI", 0x209100af, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_RMC_UART1] = {"MSGOUT-NMEA_ID_RMC_UART1", 0x209100ac, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_RMC_UART2] = {"MSGOUT-NMEA_ID_RMC_UART2", 0x209100ad, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_RMC_USB] = {"MSGOUT-NMEA_ID_RMC_USB", 0x209100ae, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VLW_I2C] = {"MSGOUT-NMEA_ID_VLW_I2C", 0x209100e7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VLW_SPI] = {"MSGOUT-NMEA_ID_VLW_SPI", 0x209100eb, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VLW_UART1] = {"MSGOUT-NMEA_ID_VLW_UART1", 0x209100e8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VLW_UART2] = {"MSGOUT-NMEA_ID_VLW_UART2", 0x209100e9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VLW_USB] = {"MSGOUT-NMEA_ID_VLW_USB", 0x209100ea, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VTG_I2C] = {"MSGOUT-NMEA_ID_VTG_I2C", 0x209100b0, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VTG_SPI] = {"MSGOUT-NMEA_ID_VTG_SPI", 0x209100b4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VTG_UART1] = {"MSGOUT-NMEA_ID_VTG_UART1", 0x209100b1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VTG_UART2] = {"MSGOUT-NMEA_ID_VTG_UART2", 0x209100b2, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_VTG_USB] = {"MSGOUT-NMEA_ID_VTG_USB", 0x209100b3, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_ZDA_I2C] = {"MSGOUT-NMEA_ID_ZDA_I2C", 0x209100d8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_ZDA_SPI] = {"MSGOUT-NMEA_ID_ZDA_SPI", 0x209100dc, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_ZDA_UART1] = {"MSGOUT-NMEA_ID_ZDA_UART1", 0x209100d9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_ZDA_UART2] = {"MSGOUT-NMEA_ID_ZDA_UART2", 0x209100da, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_NMEA_ID_ZDA_USB] = {"MSGOUT-NMEA_ID_ZDA_USB", 0x209100db, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYP_I2C] = {"MSGOUT-PUBX_ID_POLYP_I2C", 0x209100ec, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYP_SPI] = {"MSGOUT-PUBX_ID_POLYP_SPI", 0x209100f0, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYP_UART1] = {"MSGOUT-PUBX_ID_POLYP_UART1", 0x209100ed, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYP_UART2] = {"MSGOUT-PUBX_ID_POLYP_UART2", 0x209100ee, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYP_USB] = {"MSGOUT-PUBX_ID_POLYP_USB", 0x209100ef, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYS_I2C] = {"MSGOUT-PUBX_ID_POLYS_I2C", 0x209100f1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYS_SPI] = {"MSGOUT-PUBX_ID_POLYS_SPI", 0x209100f5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYS_UART1] = {"MSGOUT-PUBX_ID_POLYS_UART1", 0x209100f2, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYS_UART2] = {"MSGOUT-PUBX_ID_POLYS_UART2", 0x209100f3, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYS_USB] = {"MSGOUT-PUBX_ID_POLYS_USB", 0x209100f4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYT_I2C] = {"MSGOUT-PUBX_ID_POLYT_I2C", 0x209100f6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYT_SPI] = {"MSGOUT-PUBX_ID_POLYT_SPI", 0x209100fa, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYT_UART1] = {"MSGOUT-PUBX_ID_POLYT_UART1", 0x209100f7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYT_UART2] = {"MSGOUT-PUBX_ID_POLYT_UART2", 0x209100f8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_PUBX_ID_POLYT_USB] = {"MSGOUT-PUBX_ID_POLYT_USB", 0x209100f9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_I2C] = {"MSGOUT-RTCM_3X_TYPE1005_I2C", 0x209102bd, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_SPI] = {"MSGOUT-RTCM_3X_TYPE1005_SPI", 0x209102c1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_UART1] = {"MSGOUT-RTCM_3X_TYPE1005_UART1", 0x209102be, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_UART2] = {"MSGOUT-RTCM_3X_TYPE1005_UART2", 0x209102bf, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_USB] = {"MSGOUT-RTCM_3X_TYPE1005_USB", 0x209102c0, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_I2C] = {"MSGOUT-RTCM_3X_TYPE1074_I2C", 0x2091035e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_SPI] = {"MSGOUT-RTCM_3X_TYPE1074_SPI", 0x20910362, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_UART1] = {"MSGOUT-RTCM_3X_TYPE1074_UART1", 0x2091035f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_UART2] = {"MSGOUT-RTCM_3X_TYPE1074_UART2", 0x20910360, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_USB] = {"MSGOUT-RTCM_3X_TYPE1074_USB", 0x20910361, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_I2C] = {"MSGOUT-RTCM_3X_TYPE1077_I2C", 0x209102cc, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_SPI] = {"MSGOUT-RTCM_3X_TYPE1077_SPI", 0x209102d0, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_UART1] = {"MSGOUT-RTCM_3X_TYPE1077_UART1", 0x209102cd, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_UART2] = {"MSGOUT-RTCM_3X_TYPE1077_UART2", 0x209102ce, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_USB] = {"MSGOUT-RTCM_3X_TYPE1077_USB", 0x209102cf, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_SPI] = {"MSGOUT-RTCM_3X_TYPE1084_SPI", 0x20910367, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_UART1] = {"MSGOUT-RTCM_3X_TYPE1084_UART1", 0x20910364, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_UART2] = {"MSGOUT-RTCM_3X_TYPE1084_UART2", 0x20910365, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_USB] = {"MSGOUT-RTCM_3X_TYPE1084_USB", 0x20910366, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_I2C] = {"MSGOUT-RTCM_3X_TYPE1087_I2C", 0x209102d1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_SPI] = {"MSGOUT-RTCM_3X_TYPE1087_SPI", 0x209102d5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_UART1] = {"MSGOUT-RTCM_3X_TYPE1087_UART1", 0x209102d2, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_UART2] = {"MSGOUT-RTCM_3X_TYPE1087_UART2", 0x209102d3, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_USB] = {"MSGOUT-RTCM_3X_TYPE1087_USB", 0x209102d4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_I2C] = {"MSGOUT-RTCM_3X_TYPE1094_I2C", 0x20910368, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_SPI] = {"MSGOUT-RTCM_3X_TYPE1094_SPI", 0x2091036c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_UART1] = {"MSGOUT-RTCM_3X_TYPE1094_UART1", 0x20910369, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_UART2] = {"MSGOUT-RTCM_3X_TYPE1094_UART2", 0x2091036a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_USB] = {"MSGOUT-RTCM_3X_TYPE1094_USB", 0x2091036b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_I2C] = {"MSGOUT-RTCM_3X_TYPE1097_I2C", 0x20910318, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_SPI] = {"MSGOUT-RTCM_3X_TYPE1097_SPI", 0x2091031c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_UART1] = {"MSGOUT-RTCM_3X_TYPE1097_UART1", 0x20910319, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_UART2] = {"MSGOUT-RTCM_3X_TYPE1097_UART2", 0x2091031a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_USB] = {"MSGOUT-RTCM_3X_TYPE1097_USB", 0x2091031b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_I2C] = {"MSGOUT-RTCM_3X_TYPE1124_I2C", 0x2091036d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_SPI] = {"MSGOUT-RTCM_3X_TYPE1124_SPI", 0x20910371, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_UART1] = {"MSGOUT-RTCM_3X_TYPE1124_UART1", 0x2091036e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_UART2] = {"MSGOUT-RTCM_3X_TYPE1124_UART2", 0x2091036f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_USB] = {"MSGOUT-RTCM_3X_TYPE1124_USB", 0x20910370, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_I2C] = {"MSGOUT-RTCM_3X_TYPE1127_I2C", 0x209102d6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_SPI] = {"MSGOUT-RTCM_3X_TYPE1127_SPI", 0x209102da, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_UART1] = {"MSGOUT-RTCM_3X_TYPE1127_UART1", 0x209102d7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_UART2] = {"MSGOUT-RTCM_3X_TYPE1127_UART2", 0x209102d8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_USB] = {"MSGOUT-RTCM_3X_TYPE1127_USB", 0x209102d9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_I2C] = {"MSGOUT-RTCM_3X_TYPE1230_I2C", 0x20910303, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_SPI] = {"MSGOUT-RTCM_3X_TYPE1230_SPI", 0x20910307, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_UART1] = {"MSGOUT-RTCM_3X_TYPE1230_UART1", 0x20910304, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_UART2] = {"MSGOUT-RTCM_3X_TYPE1230_UART2", 0x20910305, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_USB] = {"MSGOUT-RTCM_3X_TYPE1230_USB", 0x20910306, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_I2C] = {"MSGOUT-RTCM_3X_TYPE4072_0_I2C", 0x209102fe, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_SPI] = {"MSGOUT-RTCM_3X_TYPE4072_0_SPI", 0x20910302, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_UART1] = {"MSGOUT-RTCM_3X_TYPE4072_0_UART1", 0x209102ff, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_UART2] = {"MSGOUT-RTCM_3X_TYPE4072_0_UART2", 0x20910300, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_USB] = {"MSGOUT-RTCM_3X_TYPE4072_0_USB", 0x20910301, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_I2C] = {"MSGOUT-RTCM_3X_TYPE4072_1_I2C", 0x20910381, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_SPI] = {"MSGOUT-RTCM_3X_TYPE4072_1_SPI", 0x20910385, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_UART1] = {"MSGOUT-RTCM_3X_TYPE4072_1_UART1", 0x20910382, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_UART2] = {"MSGOUT-RTCM_3X_TYPE4072_1_UART2", 0x20910383, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_USB] = {"MSGOUT-RTCM_3X_TYPE4072_1_USB", 0x20910384, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_LOG_INFO_I2C] = {"MSGOUT-UBX_LOG_INFO_I2C", 0x20910259, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_LOG_INFO_SPI] = {"MSGOUT-UBX_LOG_INFO_SPI", 0x2091025d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_LOG_INFO_UART1] = {"MSGOUT-UBX_LOG_INFO_UART1", 0x2091025a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_LOG_INFO_UART2] = {"MSGOUT-UBX_LOG_INFO_UART2", 0x2091025b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_LOG_INFO_USB] = {"MSGOUT-UBX_LOG_INFO_USB", 0x2091025c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_COMMS_I2C] = {"MSGOUT-UBX_MON_COMMS_I2C", 0x2091034f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_COMMS_SPI] = {"MSGOUT-UBX_MON_COMMS_SPI", 0x20910353, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_COMMS_UART1] = {"MSGOUT-UBX_MON_COMMS_UART1", 0x20910350, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_COMMS_UART2] = {"MSGOUT-UBX_MON_COMMS_UART2", 0x20910351, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_COMMS_USB] = {"MSGOUT-UBX_MON_COMMS_USB", 0x20910352, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW2_I2C] = {"MSGOUT-UBX_MON_HW2_I2C", 0x209101b9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW2_SPI] = {"MSGOUT-UBX_MON_HW2_SPI", 0x209101bd, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW2_UART1] = {"MSGOUT-UBX_MON_HW2_UART1", 0x209101ba, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW2_UART2] = {"MSGOUT-UBX_MON_HW2_UART2", 0x209101bb, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW2_USB] = {"MSGOUT-UBX_MON_HW2_USB", 0x209101bc, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW3_I2C] = {"MSGOUT-UBX_MON_HW3_I2C", 0x20910354, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW3_SPI] = {"MSGOUT-UBX_MON_HW3_SPI", 0x20910358, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW3_UART1] = {"MSGOUT-UBX_MON_HW3_UART1", 0x20910355, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW3_UART2] = {"MSGOUT-UBX_MON_HW3_UART2", 0x20910356, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW3_USB] = {"MSGOUT-UBX_MON_HW3_USB", 0x20910357, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW_I2C] = {"MSGOUT-UBX_MON_HW_I2C", 0x209101b4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW_SPI] = {"MSGOUT-UBX_MON_HW_SPI", 0x209101b8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW_UART1] = {"MSGOUT-UBX_MON_HW_UART1", 0x209101b5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW_UART2] = {"MSGOUT-UBX_MON_HW_UART2", 0x209101b6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_HW_USB] = {"MSGOUT-UBX_MON_HW_USB", 0x209101b7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_IO_I2C] = {"MSGOUT-UBX_MON_IO_I2C", 0x209101a5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_IO_SPI] = {"MSGOUT-UBX_MON_IO_SPI", 0x209101a9, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_IO_UART1] = {"MSGOUT-UBX_MON_IO_UART1", 0x209101a6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_IO_UART2] = {"MSGOUT-UBX_MON_IO_UART2", 0x209101a7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_IO_USB] = {"MSGOUT-UBX_MON_IO_USB", 0x209101a8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_MSGPP_I2C] = {"MSGOUT-UBX_MON_MSGPP_I2C", 0x20910196, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_MSGPP_SPI] = {"MSGOUT-UBX_MON_MSGPP_SPI", 0x2091019a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_MSGPP_UART1] = {"MSGOUT-UBX_MON_MSGPP_UART1", 0x20910197, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_MSGPP_UART2] = {"MSGOUT-UBX_MON_MSGPP_UART2", 0x20910198, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_MSGPP_USB] = {"MSGOUT-UBX_MON_MSGPP_USB", 0x20910199, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RF_I2C] = {"MSGOUT-UBX_MON_RF_I2C", 0x20910359, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RF_SPI] = {"MSGOUT-UBX_MON_RF_SPI", 0x2091035d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RF_UART1] = {"MSGOUT-UBX_MON_RF_UART1", 0x2091035a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RF_UART2] = {"MSGOUT-UBX_MON_RF_UART2", 0x2091035b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RF_USB] = {"MSGOUT-UBX_MON_RF_USB", 0x2091035c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXBUF_I2C] = {"MSGOUT-UBX_MON_RXBUF_I2C", 0x209101a0, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXBUF_SPI] = {"MSGOUT-UBX_MON_RXBUF_SPI", 0x209101a4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXBUF_UART1] = {"MSGOUT-UBX_MON_RXBUF_UART1", 0x209101a1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXBUF_UART2] = {"MSGOUT-UBX_MON_RXBUF_UART2", 0x209101a2, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXBUF_USB] = {"MSGOUT-UBX_MON_RXBUF_USB", 0x209101a3, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXR_I2C] = {"MSGOUT-UBX_MON_RXR_I2C", 0x20910187, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXR_SPI] = {"MSGOUT-UBX_MON_RXR_SPI", 0x2091018b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXR_UART1] = {"MSGOUT-UBX_MON_RXR_UART1", 0x20910188, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXR_UART2] = {"MSGOUT-UBX_MON_RXR_UART2", 0x20910189, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_RXR_USB] = {"MSGOUT-UBX_MON_RXR_USB", 0x2091018a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_TXBUF_I2C] = {"MSGOUT-UBX_MON_TXBUF_I2C", 0x2091019b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_TXBUF_SPI] = {"MSGOUT-UBX_MON_TXBUF_SPI", 0x2091019f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_TXBUF_UART1] = {"MSGOUT-UBX_MON_TXBUF_UART1", 0x2091019c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_TXBUF_UART2] = {"MSGOUT-UBX_MON_TXBUF_UART2", 0x2091019d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_MON_TXBUF_USB] = {"MSGOUT-UBX_MON_TXBUF_USB", 0x2091019e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_CLOCK_I2C] = {"MSGOUT-UBX_NAV_CLOCK_I2C", 0x20910065, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_CLOCK_SPI] = {"MSGOUT-UBX_NAV_CLOCK_SPI", 0x20910069, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_CLOCK_UART1] = {"MSGOUT-UBX_NAV_CLOCK_UART1", 0x20910066, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_CLOCK_UART2] = {"MSGOUT-UBX_NAV_CLOCK_UART2", 0x20910067, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_CLOCK_USB] = {"MSGOUT-UBX_NAV_CLOCK_USB", 0x20910068, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_DOP_I2C] = {"MSGOUT-UBX_NAV_DOP_I2C", 0x20910038, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_DOP_SPI] = {"MSGOUT-UBX_NAV_DOP_SPI", 0x2091003c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_DOP_UART1] = {"MSGOUT-UBX_NAV_DOP_UART1", 0x20910039, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_DOP_UART2] = {"MSGOUT-UBX_NAV_DOP_UART2", 0x2091003a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_DOP_USB] = {"MSGOUT-UBX_NAV_DOP_USB", 0x2091003b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_EOE_I2C] = {"MSGOUT-UBX_NAV_EOE_I2C", 0x2091015f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_EOE_SPI] = {"MSGOUT-UBX_NAV_EOE_SPI", 0x20910163, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_EOE_UART1] = {"MSGOUT-UBX_NAV_EOE_UART1", 0x20910160, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_EOE_UART2] = {"MSGOUT-UBX_NAV_EOE_UART2", 0x20910161, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_EOE_USB] = {"MSGOUT-UBX_NAV_EOE_USB", 0x20910162, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_I2C] = {"MSGOUT-UBX_NAV_GEOFENCE_I2C", 0x209100a1, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_SPI] = {"MSGOUT-UBX_NAV_GEOFENCE_SPI", 0x209100a5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_UART1] = {"MSGOUT-UBX_NAV_GEOFENCE_UART1", 0x209100a2, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_UART2] = {"MSGOUT-UBX_NAV_GEOFENCE_UART2", 0x209100a3, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_USB] = {"MSGOUT-UBX_NAV_GEOFENCE_USB", 0x209100a4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_I2C] = {"MSGOUT-UBX_NAV_HPPOSECEF_I2C", 0x2091002e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_SPI] = {"MSGOUT-UBX_NAV_HPPOSECEF_SPI", 0x20910032, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_UART1] = {"MSGOUT-UBX_NAV_HPPOSECEF_UART1", 0x2091002f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_UART2] = {"MSGOUT-UBX_NAV_HPPOSECEF_UART2", 0x20910030, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_USB] = {"MSGOUT-UBX_NAV_HPPOSECEF_USB", 0x20910031, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_I2C] = {"MSGOUT-UBX_NAV_HPPOSLLH_I2C", 0x20910033, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_SPI] = {"MSGOUT-UBX_NAV_HPPOSLLH_SPI", 0x20910037, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_UART1] = {"MSGOUT-UBX_NAV_HPPOSLLH_UART1", 0x20910034, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_UART2] = {"MSGOUT-UBX_NAV_HPPOSLLH_UART2", 0x20910035, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_USB] = {"MSGOUT-UBX_NAV_HPPOSLLH_USB", 0x20910036, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ODO_I2C] = {"MSGOUT-UBX_NAV_ODO_I2C", 0x2091007e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ODO_SPI] = {"MSGOUT-UBX_NAV_ODO_SPI", 0x20910082, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ODO_UART1] = {"MSGOUT-UBX_NAV_ODO_UART1", 0x2091007f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ODO_UART2] = {"MSGOUT-UBX_NAV_ODO_UART2", 0x20910080, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ODO_USB] = {"MSGOUT-UBX_NAV_ODO_USB", 0x20910081, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ORB_I2C] = {"MSGOUT-UBX_NAV_ORB_I2C", 0x20910010, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ORB_SPI] = {"MSGOUT-UBX_NAV_ORB_SPI", 0x20910014, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ORB_UART1] = {"MSGOUT-UBX_NAV_ORB_UART1", 0x20910011, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ORB_UART2] = {"MSGOUT-UBX_NAV_ORB_UART2", 0x20910012, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_ORB_USB] = {"MSGOUT-UBX_NAV_ORB_USB", 0x20910013, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSECEF_I2C] = {"MSGOUT-UBX_NAV_POSECEF_I2C", 0x20910024, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSECEF_SPI] = {"MSGOUT-UBX_NAV_POSECEF_SPI", 0x20910028, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSECEF_UART1] = {"MSGOUT-UBX_NAV_POSECEF_UART1", 0x20910025, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSECEF_UART2] = {"MSGOUT-UBX_NAV_POSECEF_UART2", 0x20910026, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSECEF_USB] = {"MSGOUT-UBX_NAV_POSECEF_USB", 0x20910027, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSLLH_I2C] = {"MSGOUT-UBX_NAV_POSLLH_I2C", 0x20910029, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSLLH_SPI] = {"MSGOUT-UBX_NAV_POSLLH_SPI", 0x2091002d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSLLH_UART1] = {"MSGOUT-UBX_NAV_POSLLH_UART1", 0x2091002a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSLLH_UART2] = {"MSGOUT-UBX_NAV_POSLLH_UART2", 0x2091002b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_POSLLH_USB] = {"MSGOUT-UBX_NAV_POSLLH_USB", 0x2091002c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_PVT_I2C] = {"MSGOUT-UBX_NAV_PVT_I2C", 0x20910006, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_PVT_SPI] = {"MSGOUT-UBX_NAV_PVT_SPI", 0x2091000a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_PVT_UART1] = {"MSGOUT-UBX_NAV_PVT_UART1", 0x20910007, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_PVT_UART2] = {"MSGOUT-UBX_NAV_PVT_UART2", 0x20910008, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_PVT_USB] = {"MSGOUT-UBX_NAV_PVT_USB", 0x20910009, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_I2C] = {"MSGOUT-UBX_NAV_RELPOSNED_I2C", 0x2091008d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_SPI] = {"MSGOUT-UBX_NAV_RELPOSNED_SPI", 0x20910091, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_UART1] = {"MSGOUT-UBX_NAV_RELPOSNED_UART1", 0x2091008e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_UART2] = {"MSGOUT-UBX_NAV_RELPOSNED_UART2", 0x2091008f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_USB] = {"MSGOUT-UBX_NAV_RELPOSNED_USB", 0x20910090, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SAT_I2C] = {"MSGOUT-UBX_NAV_SAT_I2C", 0x20910015, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SAT_SPI] = {"MSGOUT-UBX_NAV_SAT_SPI", 0x20910019, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SAT_UART1] = {"MSGOUT-UBX_NAV_SAT_UART1", 0x20910016, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SAT_UART2] = {"MSGOUT-UBX_NAV_SAT_UART2", 0x20910017, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SAT_USB] = {"MSGOUT-UBX_NAV_SAT_USB", 0x20910018, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SBAS_I2C] = {"MSGOUT-UBX_NAV_SBAS_I2C", 0x2091006a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SBAS_SPI] = {"MSGOUT-UBX_NAV_SBAS_SPI", 0x2091006e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SBAS_UART1] = {"MSGOUT-UBX_NAV_SBAS_UART1", 0x2091006b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SBAS_UART2] = {"MSGOUT-UBX_NAV_SBAS_UART2", 0x2091006c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SBAS_USB] = {"MSGOUT-UBX_NAV_SBAS_USB", 0x2091006d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SIG_I2C] = {"MSGOUT-UBX_NAV_SIG_I2C", 0x20910345, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SIG_SPI] = {"MSGOUT-UBX_NAV_SIG_SPI", 0x20910349, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SIG_UART1] = {"MSGOUT-UBX_NAV_SIG_UART1", 0x20910346, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SIG_UART2] = {"MSGOUT-UBX_NAV_SIG_UART2", 0x20910347, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SIG_USB] = {"MSGOUT-UBX_NAV_SIG_USB", 0x20910348, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_STATUS_I2C] = {"MSGOUT-UBX_NAV_STATUS_I2C", 0x2091001a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_STATUS_SPI] = {"MSGOUT-UBX_NAV_STATUS_SPI", 0x2091001e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_STATUS_UART1] = {"MSGOUT-UBX_NAV_STATUS_UART1", 0x2091001b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_STATUS_UART2] = {"MSGOUT-UBX_NAV_STATUS_UART2", 0x2091001c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_STATUS_USB] = {"MSGOUT-UBX_NAV_STATUS_USB", 0x2091001d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SVIN_I2C] = {"MSGOUT-UBX_NAV_SVIN_I2C", 0x20910088, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SVIN_SPI] = {"MSGOUT-UBX_NAV_SVIN_SPI", 0x2091008c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SVIN_UART1] = {"MSGOUT-UBX_NAV_SVIN_UART1", 0x20910089, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SVIN_UART2] = {"MSGOUT-UBX_NAV_SVIN_UART2", 0x2091008a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_SVIN_USB] = {"MSGOUT-UBX_NAV_SVIN_USB", 0x2091008b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_I2C] = {"MSGOUT-UBX_NAV_TIMEBDS_I2C", 0x20910051, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_SPI] = {"MSGOUT-UBX_NAV_TIMEBDS_SPI", 0x20910055, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_UART1] = {"MSGOUT-UBX_NAV_TIMEBDS_UART1", 0x20910052, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_UART2] = {"MSGOUT-UBX_NAV_TIMEBDS_UART2", 0x20910053, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_USB] = {"MSGOUT-UBX_NAV_TIMEBDS_USB", 0x20910054, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_I2C] = {"MSGOUT-UBX_NAV_TIMEGAL_I2C", 0x20910056, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_SPI] = {"MSGOUT-UBX_NAV_TIMEGAL_SPI", 0x2091005a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_UART1] = {"MSGOUT-UBX_NAV_TIMEGAL_UART1", 0x20910057, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_UART2] = {"MSGOUT-UBX_NAV_TIMEGAL_UART2", 0x20910058, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_USB] = {"MSGOUT-UBX_NAV_TIMEGAL_USB", 0x20910059, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_I2C] = {"MSGOUT-UBX_NAV_TIMEGLO_I2C", 0x2091004c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_SPI] = {"MSGOUT-UBX_NAV_TIMEGLO_SPI", 0x20910050, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_UART1] = {"MSGOUT-UBX_NAV_TIMEGLO_UART1", 0x2091004d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_UART2] = {"MSGOUT-UBX_NAV_TIMEGLO_UART2", 0x2091004e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_USB] = {"MSGOUT-UBX_NAV_TIMEGLO_USB", 0x2091004f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_I2C] = {"MSGOUT-UBX_NAV_TIMEGPS_I2C", 0x20910047, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_SPI] = {"MSGOUT-UBX_NAV_TIMEGPS_SPI", 0x2091004b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_UART1] = {"MSGOUT-UBX_NAV_TIMEGPS_UART1", 0x20910048, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_UART2] = {"MSGOUT-UBX_NAV_TIMEGPS_UART2", 0x20910049, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_USB] = {"MSGOUT-UBX_NAV_TIMEGPS_USB", 0x2091004a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMELS_I2C] = {"MSGOUT-UBX_NAV_TIMELS_I2C", 0x20910060, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMELS_SPI] = {"MSGOUT-UBX_NAV_TIMELS_SPI", 0x20910064, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMELS_UART1] = {"MSGOUT-UBX_NAV_TIMELS_UART1", 0x20910061, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMELS_UART2] = {"MSGOUT-UBX_NAV_TIMELS_UART2", 0x20910062, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMELS_USB] = {"MSGOUT-UBX_NAV_TIMELS_USB", 0x20910063, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_I2C] = {"MSGOUT-UBX_NAV_TIMEUTC_I2C", 0x2091005b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_SPI] = {"MSGOUT-UBX_NAV_TIMEUTC_SPI", 0x2091005f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_UART1] = {"MSGOUT-UBX_NAV_TIMEUTC_UART1", 0x2091005c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_UART2] = {"MSGOUT-UBX_NAV_TIMEUTC_UART2", 0x2091005d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_USB] = {"MSGOUT-UBX_NAV_TIMEUTC_USB", 0x2091005e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELECEF_I2C] = {"MSGOUT-UBX_NAV_VELECEF_I2C", 0x2091003d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELECEF_SPI] = {"MSGOUT-UBX_NAV_VELECEF_SPI", 0x20910041, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELECEF_UART1] = {"MSGOUT-UBX_NAV_VELECEF_UART1", 0x2091003e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELECEF_UART2] = {"MSGOUT-UBX_NAV_VELECEF_UART2", 0x2091003f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELECEF_USB] = {"MSGOUT-UBX_NAV_VELECEF_USB", 0x20910040, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELNED_I2C] = {"MSGOUT-UBX_NAV_VELNED_I2C", 0x20910042, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELNED_SPI] = {"MSGOUT-UBX_NAV_VELNED_SPI", 0x20910046, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELNED_UART1] = {"MSGOUT-UBX_NAV_VELNED_UART1", 0x20910043, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELNED_UART2] = {"MSGOUT-UBX_NAV_VELNED_UART2", 0x20910044, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_NAV_VELNED_USB] = {"MSGOUT-UBX_NAV_VELNED_USB", 0x20910045, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_MEASX_I2C] = {"MSGOUT-UBX_RXM_MEASX_I2C", 0x20910204, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_MEASX_SPI] = {"MSGOUT-UBX_RXM_MEASX_SPI", 0x20910208, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_MEASX_UART1] = {"MSGOUT-UBX_RXM_MEASX_UART1", 0x20910205, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_MEASX_UART2] = {"MSGOUT-UBX_RXM_MEASX_UART2", 0x20910206, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_MEASX_USB] = {"MSGOUT-UBX_RXM_MEASX_USB", 0x20910207, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RAWX_I2C] = {"MSGOUT-UBX_RXM_RAWX_I2C", 0x209102a4, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RAWX_SPI] = {"MSGOUT-UBX_RXM_RAWX_SPI", 0x209102a8, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RAWX_UART1] = {"MSGOUT-UBX_RXM_RAWX_UART1", 0x209102a5, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RAWX_UART2] = {"MSGOUT-UBX_RXM_RAWX_UART2", 0x209102a6, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RAWX_USB] = {"MSGOUT-UBX_RXM_RAWX_USB", 0x209102a7, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RLM_I2C] = {"MSGOUT-UBX_RXM_RLM_I2C", 0x2091025e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RLM_SPI] = {"MSGOUT-UBX_RXM_RLM_SPI", 0x20910262, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RLM_UART1] = {"MSGOUT-UBX_RXM_RLM_UART1", 0x2091025f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RLM_UART2] = {"MSGOUT-UBX_RXM_RLM_UART2", 0x20910260, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RLM_USB] = {"MSGOUT-UBX_RXM_RLM_USB", 0x20910261, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RTCM_I2C] = {"MSGOUT-UBX_RXM_RTCM_I2C", 0x20910268, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RTCM_SPI] = {"MSGOUT-UBX_RXM_RTCM_SPI", 0x2091026c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RTCM_UART1] = {"MSGOUT-UBX_RXM_RTCM_UART1", 0x20910269, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RTCM_UART2] = {"MSGOUT-UBX_RXM_RTCM_UART2", 0x2091026a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_RTCM_USB] = {"MSGOUT-UBX_RXM_RTCM_USB", 0x2091026b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_SFRBX_I2C] = {"MSGOUT-UBX_RXM_SFRBX_I2C", 0x20910231, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_SFRBX_SPI] = {"MSGOUT-UBX_RXM_SFRBX_SPI", 0x20910235, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_SFRBX_UART1] = {"MSGOUT-UBX_RXM_SFRBX_UART1", 0x20910232, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_SFRBX_UART2] = {"MSGOUT-UBX_RXM_SFRBX_UART2", 0x20910233, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_RXM_SFRBX_USB] = {"MSGOUT-UBX_RXM_SFRBX_USB", 0x20910234, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_SVIN_I2C] = {"MSGOUT-UBX_TIM_SVIN_I2C", 0x20910097, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_SVIN_SPI] = {"MSGOUT-UBX_TIM_SVIN_SPI", 0x2091009b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_SVIN_UART1] = {"MSGOUT-UBX_TIM_SVIN_UART1", 0x20910098, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_SVIN_UART2] = {"MSGOUT-UBX_TIM_SVIN_UART2", 0x20910099, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_SVIN_USB] = {"MSGOUT-UBX_TIM_SVIN_USB", 0x2091009a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TM2_I2C] = {"MSGOUT-UBX_TIM_TM2_I2C", 0x20910178, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TM2_SPI] = {"MSGOUT-UBX_TIM_TM2_SPI", 0x2091017c, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TM2_UART1] = {"MSGOUT-UBX_TIM_TM2_UART1", 0x20910179, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TM2_UART2] = {"MSGOUT-UBX_TIM_TM2_UART2", 0x2091017a, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TM2_USB] = {"MSGOUT-UBX_TIM_TM2_USB", 0x2091017b, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TP_I2C] = {"MSGOUT-UBX_TIM_TP_I2C", 0x2091017d, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TP_SPI] = {"MSGOUT-UBX_TIM_TP_SPI", 0x20910181, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TP_UART1] = {"MSGOUT-UBX_TIM_TP_UART1", 0x2091017e, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TP_UART2] = {"MSGOUT-UBX_TIM_TP_UART2", 0x2091017f, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_TP_USB] = {"MSGOUT-UBX_TIM_TP_USB", 0x20910180, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_VRFY_I2C] = {"MSGOUT-UBX_TIM_VRFY_I2C", 0x20910092, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_VRFY_SPI] = {"MSGOUT-UBX_TIM_VRFY_SPI", 0x20910096, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_VRFY_UART1] = {"MSGOUT-UBX_TIM_VRFY_UART1", 0x20910093, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_VRFY_UART2] = {"MSGOUT-UBX_TIM_VRFY_UART2", 0x20910094, UBX_VAL_U1},
+    [UBX_KEY_MSGOUT_UBX_TIM_VRFY_USB] = {"MSGOUT-UBX_TIM_VRFY_USB", 0x20910095, UBX_VAL_U1},
+    [UBX_KEY_NAVHPG_DGNSSMODE] = {"NAVHPG-DGNSSMODE", 0x20140011, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_ACKAIDING] = {"NAVSPG-ACKAIDING", 0x10110025, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_CONSTR_ALT] = {"NAVSPG-CONSTR_ALT", 0x401100c1, UBX_VAL_I4},
+    [UBX_KEY_NAVSPG_CONSTR_ALTVAR] = {"NAVSPG-CONSTR_ALTVAR", 0x401100c2, UBX_VAL_U4},
+    [UBX_KEY_NAVSPG_CONSTR_DGNSSTO] = {"NAVSPG-CONSTR_DGNSSTO", 0x201100c4, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_DYNMODEL] = {"NAVSPG-DYNMODEL", 0x20110021, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_FIXMODE] = {"NAVSPG-FIXMODE", 0x20110011, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_INFIL_CNOTHRS] = {"NAVSPG-INFIL_CNOTHRS", 0x201100ab, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_INFIL_MAXSVS] = {"NAVSPG-INFIL_MAXSVS", 0x201100a2, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_INFIL_MINCNO] = {"NAVSPG-INFIL_MINCNO", 0x201100a3, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_INFIL_MINELEV] = {"NAVSPG-INFIL_MINELEV", 0x201100a4, UBX_VAL_I1},
+    [UBX_KEY_NAVSPG_INFIL_MINSVS] = {"NAVSPG-INFIL_MINSVS", 0x201100a1, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_INFIL_NCNOTHRS] = {"NAVSPG-INFIL_NCNOTHRS", 0x201100aa, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_INIFIX3D] = {"NAVSPG-INIFIX3D", 0x10110013, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_OUTFIL_FACC] = {"NAVSPG-OUTFIL_FACC", 0x301100b5, UBX_VAL_U2},
+    [UBX_KEY_NAVSPG_OUTFIL_PACC] = {"NAVSPG-OUTFIL_PACC", 0x301100b3, UBX_VAL_U2},
+    [UBX_KEY_NAVSPG_OUTFIL_PDOP] = {"NAVSPG-OUTFIL_PDOP", 0x301100b1, UBX_VAL_U2},
+    [UBX_KEY_NAVSPG_OUTFIL_TACC] = {"NAVSPG-OUTFIL_TACC", 0x301100b4, UBX_VAL_U2},
+    [UBX_KEY_NAVSPG_OUTFIL_TDOP] = {"NAVSPG-OUTFIL_TDOP", 0x301100b2, UBX_VAL_U2},
+    [UBX_KEY_NAVSPG_USE_PPP] = {"NAVSPG-USE_PPP", 0x10110019, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_USE_USRDAT] = {"NAVSPG-USE_USRDAT", 0x10110061, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_USRDAT_DX] = {"NAVSPG-USRDAT_DX", 0x40110064, UBX_VAL_R4},
+    [UBX_KEY_NAVSPG_USRDAT_DY] = {"NAVSPG-USRDAT_DY", 0x40110065, UBX_VAL_R4},
+    [UBX_KEY_NAVSPG_USRDAT_DZ] = {"NAVSPG-USRDAT_DZ", 0x40110066, UBX_VAL_R4},
+    [UBX_KEY_NAVSPG_USRDAT_FLAT] = {"NAVSPG-USRDAT_FLAT", 0x50110063, UBX_VAL_R8},
+    [UBX_KEY_NAVSPG_USRDAT_MAJA] = {"NAVSPG-USRDAT_MAJA", 0x50110062, UBX_VAL_R8},
+    [UBX_KEY_NAVSPG_USRDAT_ROTX] = {"NAVSPG-USRDAT_ROTX", 0x40110067, UBX_VAL_R4},
+    [UBX_KEY_NAVSPG_USRDAT_ROTY] = {"NAVSPG-USRDAT_ROTY", 0x40110068, UBX_VAL_R4},
+    [UBX_KEY_NAVSPG_USRDAT_ROTZ] = {"NAVSPG-USRDAT_ROTZ", 0x40110069, UBX_VAL_R4},
+    [UBX_KEY_NAVSPG_USRDAT_SCALE] = {"NAVSPG-USRDAT_SCALE", 0x4011006a, UBX_VAL_R4},
+    [UBX_KEY_NAVSPG_UTCSTANDARD] = {"NAVSPG-UTCSTANDARD", 0x2011001c, UBX_VAL_U1},
+    [UBX_KEY_NAVSPG_WKNROLLOVER] = {"NAVSPG-WKNROLLOVER", 0x30110017, UBX_VAL_U2},
+    [UBX_KEY_NMEA_BDSTALKERID] = {"NMEA-BDSTALKERID", 0x30930033, UBX_VAL_U2},
+    [UBX_KEY_NMEA_COMPAT] = {"NMEA-COMPAT", 0x10930003, UBX_VAL_U1},
+    [UBX_KEY_NMEA_CONSIDER] = {"NMEA-CONSIDER", 0x10930004, UBX_VAL_U1},
+    [UBX_KEY_NMEA_FILT_BDS] = {"NMEA-FILT_BDS", 0x10930017, UBX_VAL_U1},
+    [UBX_KEY_NMEA_FILT_GLO] = {"NMEA-FILT_GLO", 0x10930016, UBX_VAL_U1},
+    [UBX_KEY_NMEA_FILT_GPS] = {"NMEA-FILT_GPS", 0x10930011, UBX_VAL_U1},
+    [UBX_KEY_NMEA_FILT_QZSS] = {"NMEA-FILT_QZSS", 0x10930015, UBX_VAL_U1},
+    [UBX_KEY_NMEA_FILT_SBAS] = {"NMEA-FILT_SBAS", 0x10930012, UBX_VAL_U1},
+    [UBX_KEY_NMEA_GSVTALKERID] = {"NMEA-GSVTALKERID", 0x20930032, UBX_VAL_U1},
+    [UBX_KEY_NMEA_HIGHPREC] = {"NMEA-HIGHPREC", 0x10930006, UBX_VAL_U1},
+    [UBX_KEY_NMEA_LIMIT82] = {"NMEA-LIMIT82", 0x10930005, UBX_VAL_U1},
+    [UBX_KEY_NMEA_MAINTALKERID] = {"NMEA-MAINTALKERID", 0x20930031, UBX_VAL_U1},
+    [UBX_KEY_NMEA_MAXSVS] = {"NMEA-MAXSVS", 0x20930002, UBX_VAL_U1},
+    [UBX_KEY_NMEA_OUT_FROZENCOG] = {"NMEA-OUT_FROZENCOG", 0x10930026, UBX_VAL_U1},
+    [UBX_KEY_NMEA_OUT_INVDATE] = {"NMEA-OUT_INVDATE", 0x10930024, UBX_VAL_U1},
+    [UBX_KEY_NMEA_OUT_INVFIX] = {"NMEA-OUT_INVFIX", 0x10930021, UBX_VAL_U1},
+    [UBX_KEY_NMEA_OUT_INVTIME] = {"NMEA-OUT_INVTIME", 0x10930023, UBX_VAL_U1},
+    [UBX_KEY_NMEA_OUT_MSKFIX] = {"NMEA-OUT_MSKFIX", 0x10930022, UBX_VAL_U1},
+    [UBX_KEY_NMEA_OUT_ONLYGPS] = {"NMEA-OUT_ONLYGPS", 0x10930025, UBX_VAL_U1},
+    [UBX_KEY_NMEA_PROTVER] = {"NMEA-PROTVER", 0x20930001, UBX_VAL_U1},
+    [UBX_KEY_NMEA_SVNUMBERING] = {"NMEA-SVNUMBERING", 0x20930007, UBX_VAL_U1},
+    [UBX_KEY_ODO_COGLPGAIN] = {"ODO-COGLPGAIN", 0x20220032, UBX_VAL_U1},
+    [UBX_KEY_ODO_COGMAXPOSACC] = {"ODO-COGMAXPOSACC", 0x20220022, UBX_VAL_U1},
+    [UBX_KEY_ODO_COGMAXSPEED] = {"ODO-COGMAXSPEED", 0x20220021, UBX_VAL_U1},
+    [UBX_KEY_ODO_OUTLPCOG] = {"ODO-OUTLPCOG", 0x10220004, UBX_VAL_U1},
+    [UBX_KEY_ODO_OUTLPVEL] = {"ODO-OUTLPVEL", 0x10220003, UBX_VAL_U1},
+    [UBX_KEY_ODO_PROFILE] = {"ODO-PROFILE", 0x20220005, UBX_VAL_U1},
+    [UBX_KEY_ODO_USE_COG] = {"ODO-USE_COG", 0x10220002, UBX_VAL_U1},
+    [UBX_KEY_ODO_USE_ODO] = {"ODO-USE_ODO", 0x10220001, UBX_VAL_U1},
+    [UBX_KEY_ODO_VELLPGAIN] = {"ODO-VELLPGAIN", 0x20220031, UBX_VAL_U1},
+    [UBX_KEY_RATE_MEAS] = {"RATE-MEAS", 0x30210001, UBX_VAL_U2},
+    [UBX_KEY_RATE_NAV] = {"RATE-NAV", 0x30210002, UBX_VAL_U2},
+    [UBX_KEY_RATE_TIMEREF] = {"RATE-TIMEREF", 0x20210003, UBX_VAL_U1},
+    [UBX_KEY_RINV_BINARY] = {"RINV-BINARY", 0x10c70002, UBX_VAL_U1},
+    [UBX_KEY_RINV_CHUNK0] = {"RINV-CHUNK0", 0x50c70004, UBX_VAL_U8},
+    [UBX_KEY_RINV_CHUNK1] = {"RINV-CHUNK1", 0x50c70005, UBX_VAL_U8},
+    [UBX_KEY_RINV_CHUNK2] = {"RINV-CHUNK2", 0x50c70006, UBX_VAL_U8},
+    [UBX_KEY_RINV_CHUNK3] = {"RINV-CHUNK3", 0x50c70007, UBX_VAL_U8},
+    [UBX_KEY_RINV_DATA_SIZE] = {"RINV-DATA_SIZE", 0x20c70003, UBX_VAL_U1},
+    [UBX_KEY_RINV_DUMP] = {"RINV-DUMP", 0x10c70001, UBX_VAL_U1},
+    [UBX_KEY_SBAS_PRNSCANMASK] = {"SBAS-PRNSCANMASK", 0x50360006, UBX_VAL_U8},
+    [UBX_KEY_SBAS_USE_DIFFCORR] = {"SBAS-USE_DIFFCORR", 0x10360004, UBX_VAL_U1},
+    [UBX_KEY_SBAS_USE_INTEGRITY] = {"SBAS-USE_INTEGRITY", 0x10360005, UBX_VAL_U1},
+    [UBX_KEY_SBAS_USE_RANGING] = {"SBAS-USE_RANGING", 0x10360003, UBX_VAL_U1},
+    [UBX_KEY_SBAS_USE_TESTMODE] = {"SBAS-USE_TESTMODE", 0x10360002, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_BDS_B1_ENA] = {"SIGNAL-BDS_B1_ENA", 0x1031000d, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_BDS_B2_ENA] = {"SIGNAL-BDS_B2_ENA", 0x1031000e, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_BDS_ENA] = {"SIGNAL-BDS_ENA", 0x10310022, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GAL_E1_ENA] = {"SIGNAL-GAL_E1_ENA", 0x10310007, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GAL_E5B_ENA] = {"SIGNAL-GAL_E5B_ENA", 0x1031000a, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GAL_ENA] = {"SIGNAL-GAL_ENA", 0x10310021, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GLO_ENA] = {"SIGNAL-GLO_ENA", 0x10310025, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GLO_L1_ENA] = {"SIGNAL-GLO_L1_ENA", 0x10310018, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GLO_L2_ENA] = {"SIGNAL-GLO_L2_ENA", 0x1031001a, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GPS_ENA] = {"SIGNAL-GPS_ENA", 0x1031001f, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GPS_L1CA_ENA] = {"SIGNAL-GPS_L1CA_ENA", 0x10310001, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_GPS_L2C_ENA] = {"SIGNAL-GPS_L2C_ENA", 0x10310003, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_QZSS_ENA] = {"SIGNAL-QZSS_ENA", 0x10310024, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_QZSS_L1CA_ENA] = {"SIGNAL-QZSS_L1CA_ENA", 0x10310012, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_QZSS_L1S_ENA] = {"SIGNAL-QZSS_L1S_ENA", 0x10310014, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_QZSS_L2C_ENA] = {"SIGNAL-QZSS_L2C_ENA", 0x10310015, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_SBAS_ENA] = {"SIGNAL-SBAS_ENA", 0x10310020, UBX_VAL_U1},
+    [UBX_KEY_SIGNAL_SBAS_L1CA_ENA] = {"SIGNAL-SBAS_L1CA_ENA", 0x10310005, UBX_VAL_U1},
+    [UBX_KEY_SPI_CPHASE] = {"SPI-CPHASE", 0x10640003, UBX_VAL_U1},
+    [UBX_KEY_SPI_CPOLARITY] = {"SPI-CPOLARITY", 0x10640002, UBX_VAL_U1},
+    [UBX_KEY_SPI_ENABLED] = {"SPI-ENABLED", 0x10640006, UBX_VAL_U1},
+    [UBX_KEY_SPI_EXTENDEDTIMEOUT] = {"SPI-EXTENDEDTIMEOUT", 0x10640005, UBX_VAL_U1},
+    [UBX_KEY_SPI_MAXFF] = {"SPI-MAXFF", 0x20640001, UBX_VAL_U1},
+    [UBX_KEY_SPIINPROT_NMEA] = {"SPIINPROT-NMEA", 0x10790002, UBX_VAL_U1},
+    [UBX_KEY_SPIINPROT_RTCM2X] = {"SPIINPROT-RTCM2X", 0x10790003, UBX_VAL_U1},
+    [UBX_KEY_SPIINPROT_RTCM3X] = {"SPIINPROT-RTCM3X", 0x10790004, UBX_VAL_U1},
+    [UBX_KEY_SPIINPROT_UBX] = {"SPIINPROT-UBX", 0x10790001, UBX_VAL_U1},
+    [UBX_KEY_SPIOUTPROT_NMEA] = {"SPIOUTPROT-NMEA", 0x107a0002, UBX_VAL_U1},
+    [UBX_KEY_SPIOUTPROT_RTCM3X] = {"SPIOUTPROT-RTCM3X", 0x107a0004, UBX_VAL_U1},
+    [UBX_KEY_SPIOUTPROT_UBX] = {"SPIOUTPROT-UBX", 0x107a0001, UBX_VAL_U1},
+    [UBX_KEY_TMODE_ECEF_X] = {"TMODE-ECEF_X", 0x40030003, UBX_VAL_I4},
+    [UBX_KEY_TMODE_ECEF_X_HP] = {"TMODE-ECEF_X_HP", 0x20030006, UBX_VAL_I1},
+    [UBX_KEY_TMODE_ECEF_Y] = {"TMODE-ECEF_Y", 0x40030004, UBX_VAL_I4},
+    [UBX_KEY_TMODE_ECEF_Y_HP] = {"TMODE-ECEF_Y_HP", 0x20030007, UBX_VAL_I1},
+    [UBX_KEY_TMODE_ECEF_Z] = {"TMODE-ECEF_Z", 0x40030005, UBX_VAL_I4},
+    [UBX_KEY_TMODE_ECEF_Z_HP] = {"TMODE-ECEF_Z_HP", 0x20030008, UBX_VAL_I1},
+    [UBX_KEY_TMODE_FIXED_POS_ACC] = {"TMODE-FIXED_POS_ACC", 0x4003000f, UBX_VAL_U4},
+    [UBX_KEY_TMODE_HEIGHT] = {"TMODE-HEIGHT", 0x4003000b, UBX_VAL_I4},
+    [UBX_KEY_TMODE_HEIGHT_HP] = {"TMODE-HEIGHT_HP", 0x2003000e, UBX_VAL_I1},
+    [UBX_KEY_TMODE_LAT] = {"TMODE-LAT", 0x40030009, UBX_VAL_I4},
+    [UBX_KEY_TMODE_LAT_HP] = {"TMODE-LAT_HP", 0x2003000c, UBX_VAL_I1},
+    [UBX_KEY_TMODE_LON] = {"TMODE-LON", 0x4003000a, UBX_VAL_I4},
+    [UBX_KEY_TMODE_LON_HP] = {"TMODE-LON_HP", 0x2003000d, UBX_VAL_I1},
+    [UBX_KEY_TMODE_MODE] = {"TMODE-MODE", 0x20030001, UBX_VAL_U1},
+    [UBX_KEY_TMODE_POS_TYPE] = {"TMODE-POS_TYPE", 0x20030002, UBX_VAL_U1},
+    [UBX_KEY_TMODE_SVIN_ACC_LIMIT] = {"TMODE-SVIN_ACC_LIMIT", 0x40030011, UBX_VAL_U4},
+    [UBX_KEY_TMODE_SVIN_MIN_DUR] = {"TMODE-SVIN_MIN_DUR", 0x40030010, UBX_VAL_U4},
+    [UBX_KEY_TP_ALIGN_TO_TOW_TP1] = {"TP-ALIGN_TO_TOW_TP1", 0x1005000a, UBX_VAL_U1},
+    [UBX_KEY_TP_ALIGN_TO_TOW_TP2] = {"TP-ALIGN_TO_TOW_TP2", 0x10050015, UBX_VAL_U1},
+    [UBX_KEY_TP_ANT_CABLEDELAY] = {"TP-ANT_CABLEDELAY", 0x30050001, UBX_VAL_I2},
+    [UBX_KEY_TP_DUTY_LOCK_TP1] = {"TP-DUTY_LOCK_TP1", 0x5005002b, UBX_VAL_R8},
+    [UBX_KEY_TP_DUTY_LOCK_TP2] = {"TP-DUTY_LOCK_TP2", 0x5005002d, UBX_VAL_R8},
+    [UBX_KEY_TP_DUTY_TP1] = {"TP-DUTY_TP1", 0x5005002a, UBX_VAL_R8},
+    [UBX_KEY_TP_DUTY_TP2] = {"TP-DUTY_TP2", 0x5005002c, UBX_VAL_R8},
+    [UBX_KEY_TP_FREQ_LOCK_TP1] = {"TP-FREQ_LOCK_TP1", 0x40050025, UBX_VAL_U4},
+    [UBX_KEY_TP_FREQ_LOCK_TP2] = {"TP-FREQ_LOCK_TP2", 0x40050027, UBX_VAL_U4},
+    [UBX_KEY_TP_FREQ_TP1] = {"TP-FREQ_TP1", 0x40050024, UBX_VAL_U4},
+    [UBX_KEY_TP_FREQ_TP2] = {"TP-FREQ_TP2", 0x40050026, UBX_VAL_U4},
+    [UBX_KEY_TP_LEN_LOCK_TP1] = {"TP-LEN_LOCK_TP1", 0x40050005, UBX_VAL_U4},
+    [UBX_KEY_TP_LEN_LOCK_TP2] = {"TP-LEN_LOCK_TP2", 0x40050010, UBX_VAL_U4},
+    [UBX_KEY_TP_LEN_TP1] = {"TP-LEN_TP1", 0x40050004, UBX_VAL_U4},
+    [UBX_KEY_TP_LEN_TP2] = {"TP-LEN_TP2", 0x4005000f, UBX_VAL_U4},
+    [UBX_KEY_TP_PERIOD_LOCK_TP1] = {"TP-PERIOD_LOCK_TP1", 0x40050003, UBX_VAL_U4},
+    [UBX_KEY_TP_PERIOD_LOCK_TP2] = {"TP-PERIOD_LOCK_TP2", 0x4005000e, UBX_VAL_U4},
+    [UBX_KEY_TP_PERIOD_TP1] = {"TP-PERIOD_TP1", 0x40050002, UBX_VAL_U4},
+    [UBX_KEY_TP_PERIOD_TP2] = {"TP-PERIOD_TP2", 0x4005000d, UBX_VAL_U4},
+    [UBX_KEY_TP_POL_TP1] = {"TP-POL_TP1", 0x1005000b, UBX_VAL_U1},
+    [UBX_KEY_TP_POL_TP2] = {"TP-POL_TP2", 0x10050016, UBX_VAL_U1},
+    [UBX_KEY_TP_PULSE_DEF] = {"TP-PULSE_DEF", 0x20050023, UBX_VAL_U1},
+    [UBX_KEY_TP_PULSE_LENGTH_DEF] = {"TP-PULSE_LENGTH_DEF", 0x20050030, UBX_VAL_U1},
+    [UBX_KEY_TP_SYNC_GNSS_TP1] = {"TP-SYNC_GNSS_TP1", 0x10050008, UBX_VAL_U1},
+    [UBX_KEY_TP_SYNC_GNSS_TP2] = {"TP-SYNC_GNSS_TP2", 0x10050013, UBX_VAL_U1},
+    [UBX_KEY_TP_TIMEGRID_TP1] = {"TP-TIMEGRID_TP1", 0x2005000c, UBX_VAL_U1},
+    [UBX_KEY_TP_TIMEGRID_TP2] = {"TP-TIMEGRID_TP2", 0x20050017, UBX_VAL_U1},
+    [UBX_KEY_TP_TP1_ENA] = {"TP-TP1_ENA", 0x10050007, UBX_VAL_U1},
+    [UBX_KEY_TP_TP2_ENA] = {"TP-TP2_ENA", 0x10050012, UBX_VAL_U1},
+    [UBX_KEY_TP_USER_DELAY_TP1] = {"TP-USER_DELAY_TP1", 0x40050006, UBX_VAL_I4},
+    [UBX_KEY_TP_USER_DELAY_TP2] = {"TP-USER_DELAY_TP2", 0x40050011, UBX_VAL_I4},
+    [UBX_KEY_TP_USE_LOCKED_TP1] = {"TP-USE_LOCKED_TP1", 0x10050009, UBX_VAL_U1},
+    [UBX_KEY_TP_USE_LOCKED_TP2] = {"TP-USE_LOCKED_TP2", 0x10050014, UBX_VAL_U1},
+    [UBX_KEY_UART1_BAUDRATE] = {"UART1-BAUDRATE", 0x40520001, UBX_VAL_U4},
+    [UBX_KEY_UART1_DATABITS] = {"UART1-DATABITS", 0x20520003, UBX_VAL_U1},
+    [UBX_KEY_UART1_ENABLED] = {"UART1-ENABLED", 0x10520005, UBX_VAL_U1},
+    [UBX_KEY_UART1_PARITY] = {"UART1-PARITY", 0x20520004, UBX_VAL_U1},
+    [UBX_KEY_UART1_STOPBITS] = {"UART1-STOPBITS", 0x20520002, UBX_VAL_U1},
+    [UBX_KEY_UART1INPROT_NMEA] = {"UART1INPROT-NMEA", 0x10730002, UBX_VAL_U1},
+    [UBX_KEY_UART1INPROT_RTCM2X] = {"UART1INPROT-RTCM2X", 0x10730003, UBX_VAL_U1},
+    [UBX_KEY_UART1INPROT_RTCM3X] = {"UART1INPROT-RTCM3X", 0x10730004, UBX_VAL_U1},
+    [UBX_KEY_UART1INPROT_UBX] = {"UART1INPROT-UBX", 0x10730001, UBX_VAL_U1},
+    [UBX_KEY_UART1OUTPROT_NMEA] = {"UART1OUTPROT-NMEA", 0x10740002, UBX_VAL_U1},
+    [UBX_KEY_UART1OUTPROT_RTCM3X] = {"UART1OUTPROT-RTCM3X", 0x10740004, UBX_VAL_U1},
+    [UBX_KEY_UART1OUTPROT_UBX] = {"UART1OUTPROT-UBX", 0x10740001, UBX_VAL_U1},
+    [UBX_KEY_UART2_BAUDRATE] = {"UART2-BAUDRATE", 0x40530001, UBX_VAL_U4},
+    [UBX_KEY_UART2_DATABITS] = {"UART2-DATABITS", 0x20530003, UBX_VAL_U1},
+    [UBX_KEY_UART2_ENABLED] = {"UART2-ENABLED", 0x10530005, UBX_VAL_U1},
+    [UBX_KEY_UART2_PARITY] = {"UART2-PARITY", 0x20530004, UBX_VAL_U1},
+    [UBX_KEY_UART2_REMAP] = {"UART2-REMAP", 0x10530006, UBX_VAL_U1},
+    [UBX_KEY_UART2_STOPBITS] = {"UART2-STOPBITS", 0x20530002, UBX_VAL_U1},
+    [UBX_KEY_UART2INPROT_NMEA] = {"UART2INPROT-NMEA", 0x10750002, UBX_VAL_U1},
+    [UBX_KEY_UART2INPROT_RTCM2X] = {"UART2INPROT-RTCM2X", 0x10750003, UBX_VAL_U1},
+    [UBX_KEY_UART2INPROT_RTCM3X] = {"UART2INPROT-RTCM3X", 0x10750004, UBX_VAL_U1},
+    [UBX_KEY_UART2INPROT_UBX] = {"UART2INPROT-UBX", 0x10750001, UBX_VAL_U1},
+    [UBX_KEY_UART2OUTPROT_NMEA] = {"UART2OUTPROT-NMEA", 0x10760002, UBX_VAL_U1},
+    [UBX_KEY_UART2OUTPROT_RTCM3X] = {"UART2OUTPROT-RTCM3X", 0x10760004, UBX_VAL_U1},
+    [UBX_KEY_UART2OUTPROT_UBX] = {"UART2OUTPROT-UBX", 0x10760001, UBX_VAL_U1},
+    [UBX_KEY_USB_ENABLED] = {"USB-ENABLED", 0x10650001, UBX_VAL_U1},
+    [UBX_KEY_USB_POWER] = {"USB-POWER", 0x3065000c, UBX_VAL_U2},
+    [UBX_KEY_USB_PRODUCT_ID] = {"USB-PRODUCT_ID", 0x3065000b, UBX_VAL_U2},
+    [UBX_KEY_USB_PRODUCT_STR0] = {"USB-PRODUCT_STR0", 0x50650011, UBX_VAL_U8},
+    [UBX_KEY_USB_PRODUCT_STR1] = {"USB-PRODUCT_STR1", 0x50650012, UBX_VAL_U8},
+    [UBX_KEY_USB_PRODUCT_STR2] = {"USB-PRODUCT_STR2", 0x50650013, UBX_VAL_U8},
+    [UBX_KEY_USB_PRODUCT_STR3] = {"USB-PRODUCT_STR3", 0x50650014, UBX_VAL_U8},
+    [UBX_KEY_USB_SELFPOW] = {"USB-SELFPOW", 0x10650002, UBX_VAL_U1},
+    [UBX_KEY_USB_SERIAL_NO_STR0] = {"USB-SERIAL_NO_STR0", 0x50650015, UBX_VAL_U8},
+    [UBX_KEY_USB_SERIAL_NO_STR1] = {"USB-SERIAL_NO_STR1", 0x50650016, UBX_VAL_U8},
+    [UBX_KEY_USB_SERIAL_NO_STR2] = {"USB-SERIAL_NO_STR2", 0x50650017, UBX_VAL_U8},
+    [UBX_KEY_USB_SERIAL_NO_STR3] = {"USB-SERIAL_NO_STR3", 0x50650018, UBX_VAL_U8},
+    [UBX_KEY_USB_VENDOR_ID] = {"USB-VENDOR_ID", 0x3065000a, UBX_VAL_U2},
+    [UBX_KEY_USB_VENDOR_STR0] = {"USB-VENDOR_STR0", 0x5065000d, UBX_VAL_U8},
+    [UBX_KEY_USB_VENDOR_STR1] = {"USB-VENDOR_STR1", 0x5065000e, UBX_VAL_U8},
+    [UBX_KEY_USB_VENDOR_STR2] = {"USB-VENDOR_STR2", 0x5065000f, UBX_VAL_U8},
+    [UBX_KEY_USB_VENDOR_STR3] = {"USB-VENDOR_STR3", 0x50650010, UBX_VAL_U8},
+    [UBX_KEY_USBINPROT_NMEA] = {"USBINPROT-NMEA", 0x10770002, UBX_VAL_U1},
+    [UBX_KEY_USBINPROT_RTCM2X] = {"USBINPROT-RTCM2X", 0x10770003, UBX_VAL_U1},
+    [UBX_KEY_USBINPROT_RTCM3X] = {"USBINPROT-RTCM3X", 0x10770004, UBX_VAL_U1},
+    [UBX_KEY_USBINPROT_UBX] = {"USBINPROT-UBX", 0x10770001, UBX_VAL_U1},
+    [UBX_KEY_USBOUTPROT_NMEA] = {"USBOUTPROT-NMEA", 0x10780002, UBX_VAL_U1},
+    [UBX_KEY_USBOUTPROT_RTCM3X] = {"USBOUTPROT-RTCM3X", 0x10780004, UBX_VAL_U1},
+    [UBX_KEY_USBOUTPROT_UBX] = {"USBOUTPROT-UBX", 0x10780001, UBX_VAL_U1},
+};
@@ -0,0 +1,670 @@
+// generated by scripts/gen_ubx_keys.py from scripts/ubx_keys.csv, do not edit
+#ifndef ESP32S3_GNSS_UBX_KEYS_H
+#define ESP32S3_GNSS_UBX_KEYS_H
+
+#include <stdint.h>
+
+typedef enum
+{
+    UBX_VAL_U1 = 1,
+    UBX_VAL_U2,
+    UBX_VAL_U4,
+    UBX_VAL_U8,
+    UBX_VAL_I1,
+    UBX_VAL_I2,
+    UBX_VAL_I4,
+    UBX_VAL_R4,
+    UBX_VAL_R8,
+} ubx_val_t;
+
+// configuration keys without the CFG- prefix, in name order
+typedef enum
+{
+    UBX_KEY_GEOFENCE_CONFLVL,
+    UBX_KEY_GEOFENCE_FENCE1_LAT,
+    UBX_KEY_GEOFENCE_FENCE1_LON,
+    UBX_KEY_GEOFENCE_FENCE1_RAD,
+    UBX_KEY_GEOFENCE_FENCE2_LAT,
+    UBX_KEY_GEOFENCE_FENCE2_LON,
+    UBX_KEY_GEOFENCE_FENCE2_RAD,
+    UBX_KEY_GEOFENCE_FENCE3_LAT,
+    UBX_KEY_GEOFENCE_FENCE3_LON,
+    UBX_KEY_GEOFENCE_FENCE3_RAD,
+    UBX_KEY_GEOFENCE_FENCE4_LAT,
+    UBX_KEY_GEOFENCE_FENCE4_LON,
+    UBX_KEY_GEOFENCE_FENCE4_RAD,
+    UBX_KEY_GEOFENCE_PIN,
+    UBX_KEY_GEOFENCE_PINPOL,
+    UBX_KEY_GEOFENCE_USE_FENCE1,
+    UBX_KEY_GEOFENCE_USE_FENCE2,
+    UBX_KEY_GEOFENCE_USE_FENCE3,
+    UBX_KEY_GEOFENCE_USE_FENCE4,
+    UBX_KEY_GEOFENCE_USE_PIO,
+    UBX_KEY_HW_ANT_CFG_OPENDET,
+    UBX_KEY_HW_ANT_CFG_OPENDET_POL,
+    UBX_KEY_HW_ANT_CFG_PWRDOWN,
+    UBX_KEY_HW_ANT_CFG_PWRDOWN_POL,
+    UBX_KEY_HW_ANT_CFG_RECOVER,
+    UBX_KEY_HW_ANT_CFG_SHORTDET,
+    UBX_KEY_HW_ANT_CFG_SHORTDET_POL,
+    UBX_KEY_HW_ANT_CFG_VOLTCTRL,
+    UBX_KEY_HW_ANT_SUP_OPEN_PIN,
+    UBX_KEY_HW_ANT_SUP_SHORT_PIN,
+    UBX_KEY_HW_ANT_SUP_SWITCH_PIN,
+    UBX_KEY_I2C_ADDRESS,
+    UBX_KEY_I2C_ENABLED,
+    UBX_KEY_I2C_EXTENDEDTIMEOUT,
+    UBX_KEY_I2CINPROT_NMEA,
+    UBX_KEY_I2CINPROT_RTCM2X,
+    UBX_KEY_I2CINPROT_RTCM3X,
+    UBX_KEY_I2CINPROT_UBX,
+    UBX_KEY_I2COUTPROT_NMEA,
+    UBX_KEY_I2COUTPROT_RTCM3X,
+    UBX_KEY_I2COUTPROT_UBX,
+    UBX_KEY_INFMSG_NMEA_I2C,
+    UBX_KEY_INFMSG_NMEA_SPI,
+    UBX_KEY_INFMSG_NMEA_UART1,
+    UBX_KEY_INFMSG_NMEA_UART2,
+    UBX_KEY_INFMSG_NMEA_USB,
+    UBX_KEY_INFMSG_UBX_I2C,
+    UBX_KEY_INFMSG_UBX_SPI,
+    UBX_KEY_INFMSG_UBX_UART1,
+    UBX_KEY_INFMSG_UBX_UART2,
+    UBX_KEY_INFMSG_UBX_USB,
+    UBX_KEY_ITFM_ANTSETTING,
+    UBX_KEY_ITFM_BBTHRESHOLD,
+    UBX_KEY_ITFM_CWTHRESHOLD,
+    UBX_KEY_ITFM_ENABLE,
+    UBX_KEY_ITFM_ENABLE_AUX,
+    UBX_KEY_LOGFILTER_APPLY_ALL_FILTERS,
+    UBX_KEY_LOGFILTER_MIN_INTERVAL,
+    UBX_KEY_LOGFILTER_ONCE_PER_WAKE_UP_ENA,
+    UBX_KEY_LOGFILTER_POSITION_THRS,
+    UBX_KEY_LOGFILTER_RECORD_ENA,
+    UBX_KEY_LOGFILTER_SPEED_THRS,
+    UBX_KEY_LOGFILTER_TIME_THRS,
+    UBX_KEY_MOT_GNSSDIST_THRS,
+    UBX_KEY_MOT_GNSSSPEED_THRS,
+    UBX_KEY_MSGOUT_NMEA_ID_DTM_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_DTM_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_DTM_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_DTM_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_DTM_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_GBS_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_GBS_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_GBS_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_GBS_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_GBS_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_GGA_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_GGA_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_GGA_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_GGA_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_GGA_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_GLL_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_GLL_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_GLL_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_GLL_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_GLL_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_GNS_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_GNS_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_GNS_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_GNS_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_GNS_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_GRS_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_GRS_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_GRS_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_GRS_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_GRS_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_GSA_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_GSA_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_GSA_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_GSA_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_GSA_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_GST_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_GST_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_GST_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_GST_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_GST_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_GSV_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_GSV_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_GSV_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_GSV_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_GSV_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_RMC_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_RMC_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_RMC_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_RMC_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_RMC_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_VLW_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_VLW_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_VLW_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_VLW_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_VLW_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_VTG_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_VTG_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_VTG_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_VTG_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_VTG_USB,
+    UBX_KEY_MSGOUT_NMEA_ID_ZDA_I2C,
+    UBX_KEY_MSGOUT_NMEA_ID_ZDA_SPI,
+    UBX_KEY_MSGOUT_NMEA_ID_ZDA_UART1,
+    UBX_KEY_MSGOUT_NMEA_ID_ZDA_UART2,
+    UBX_KEY_MSGOUT_NMEA_ID_ZDA_USB,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYP_I2C,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYP_SPI,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYP_UART1,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYP_UART2,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYP_USB,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYS_I2C,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYS_SPI,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYS_UART1,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYS_UART2,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYS_USB,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYT_I2C,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYT_SPI,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYT_UART1,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYT_UART2,
+    UBX_KEY_MSGOUT_PUBX_ID_POLYT_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1074_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1084_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1087_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1094_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1097_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1124_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1127_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE1230_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_0_USB,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_I2C,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_SPI,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_UART1,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_UART2,
+    UBX_KEY_MSGOUT_RTCM_3X_TYPE4072_1_USB,
+    UBX_KEY_MSGOUT_UBX_LOG_INFO_I2C,
+    UBX_KEY_MSGOUT_UBX_LOG_INFO_SPI,
+    UBX_KEY_MSGOUT_UBX_LOG_INFO_UART1,
+    UBX_KEY_MSGOUT_UBX_LOG_INFO_UART2,
+    UBX_KEY_MSGOUT_UBX_LOG_INFO_USB,
+    UBX_KEY_MSGOUT_UBX_MON_COMMS_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_COMMS_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_COMMS_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_COMMS_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_COMMS_USB,
+    UBX_KEY_MSGOUT_UBX_MON_HW2_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_HW2_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_HW2_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_HW2_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_HW2_USB,
+    UBX_KEY_MSGOUT_UBX_MON_HW3_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_HW3_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_HW3_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_HW3_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_HW3_USB,
+    UBX_KEY_MSGOUT_UBX_MON_HW_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_HW_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_HW_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_HW_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_HW_USB,
+    UBX_KEY_MSGOUT_UBX_MON_IO_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_IO_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_IO_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_IO_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_IO_USB,
+    UBX_KEY_MSGOUT_UBX_MON_MSGPP_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_MSGPP_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_MSGPP_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_MSGPP_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_MSGPP_USB,
+    UBX_KEY_MSGOUT_UBX_MON_RF_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_RF_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_RF_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_RF_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_RF_USB,
+    UBX_KEY_MSGOUT_UBX_MON_RXBUF_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_RXBUF_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_RXBUF_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_RXBUF_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_RXBUF_USB,
+    UBX_KEY_MSGOUT_UBX_MON_RXR_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_RXR_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_RXR_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_RXR_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_RXR_USB,
+    UBX_KEY_MSGOUT_UBX_MON_TXBUF_I2C,
+    UBX_KEY_MSGOUT_UBX_MON_TXBUF_SPI,
+    UBX_KEY_MSGOUT_UBX_MON_TXBUF_UART1,
+    UBX_KEY_MSGOUT_UBX_MON_TXBUF_UART2,
+    UBX_KEY_MSGOUT_UBX_MON_TXBUF_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_CLOCK_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_CLOCK_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_CLOCK_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_CLOCK_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_CLOCK_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_DOP_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_DOP_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_DOP_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_DOP_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_DOP_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_EOE_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_EOE_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_EOE_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_EOE_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_EOE_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_GEOFENCE_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSECEF_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_HPPOSLLH_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_ODO_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_ODO_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_ODO_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_ODO_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_ODO_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_ORB_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_ORB_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_ORB_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_ORB_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_ORB_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_POSECEF_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_POSECEF_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_POSECEF_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_POSECEF_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_POSECEF_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_POSLLH_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_POSLLH_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_POSLLH_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_POSLLH_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_POSLLH_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_PVT_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_PVT_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_PVT_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_PVT_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_PVT_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_RELPOSNED_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_SAT_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_SAT_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_SAT_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_SAT_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_SAT_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_SBAS_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_SBAS_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_SBAS_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_SBAS_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_SBAS_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_SIG_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_SIG_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_SIG_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_SIG_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_SIG_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_STATUS_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_STATUS_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_STATUS_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_STATUS_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_STATUS_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_SVIN_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_SVIN_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_SVIN_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_SVIN_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_SVIN_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEBDS_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGAL_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGLO_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEGPS_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMELS_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMELS_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMELS_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMELS_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMELS_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_TIMEUTC_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_VELECEF_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_VELECEF_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_VELECEF_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_VELECEF_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_VELECEF_USB,
+    UBX_KEY_MSGOUT_UBX_NAV_VELNED_I2C,
+    UBX_KEY_MSGOUT_UBX_NAV_VELNED_SPI,
+    UBX_KEY_MSGOUT_UBX_NAV_VELNED_UART1,
+    UBX_KEY_MSGOUT_UBX_NAV_VELNED_UART2,
+    UBX_KEY_MSGOUT_UBX_NAV_VELNED_USB,
+    UBX_KEY_MSGOUT_UBX_RXM_MEASX_I2C,
+    UBX_KEY_MSGOUT_UBX_RXM_MEASX_SPI,
+    UBX_KEY_MSGOUT_UBX_RXM_MEASX_UART1,
+    UBX_KEY_MSGOUT_UBX_RXM_MEASX_UART2,
+    UBX_KEY_MSGOUT_UBX_RXM_MEASX_USB,
+    UBX_KEY_MSGOUT_UBX_RXM_RAWX_I2C,
+    UBX_KEY_MSGOUT_UBX_RXM_RAWX_SPI,
+    UBX_KEY_MSGOUT_UBX_RXM_RAWX_UART1,
+    UBX_KEY_MSGOUT_UBX_RXM_RAWX_UART2,
+    UBX_KEY_MSGOUT_UBX_RXM_RAWX_USB,
+    UBX_KEY_MSGOUT_UBX_RXM_RLM_I2C,
+    UBX_KEY_MSGOUT_UBX_RXM_RLM_SPI,
+    UBX_KEY_MSGOUT_UBX_RXM_RLM_UART1,
+    UBX_KEY_MSGOUT_UBX_RXM_RLM_UART2,
+    UBX_KEY_MSGOUT_UBX_RXM_RLM_USB,
+    UBX_KEY_MSGOUT_UBX_RXM_RTCM_I2C,
+    UBX_KEY_MSGOUT_UBX_RXM_RTCM_SPI,
+    UBX_KEY_MSGOUT_UBX_RXM_RTCM_UART1,
+    UBX_KEY_MSGOUT_UBX_RXM_RTCM_UART2,
+    UBX_KEY_MSGOUT_UBX_RXM_RTCM_USB,
+    UBX_KEY_MSGOUT_UBX_RXM_SFRBX_I2C,
+    UBX_KEY_MSGOUT_UBX_RXM_SFRBX_SPI,
+    UBX_KEY_MSGOUT_UBX_RXM_SFRBX_UART1,
+    UBX_KEY_MSGOUT_UBX_RXM_SFRBX_UART2,
+    UBX_KEY_MSGOUT_UBX_RXM_SFRBX_USB,
+    UBX_KEY_MSGOUT_UBX_TIM_SVIN_I2C,
+    UBX_KEY_MSGOUT_UBX_TIM_SVIN_SPI,
+    UBX_KEY_MSGOUT_UBX_TIM_SVIN_UART1,
+    UBX_KEY_MSGOUT_UBX_TIM_SVIN_UART2,
+    UBX_KEY_MSGOUT_UBX_TIM_SVIN_USB,
+    UBX_KEY_MSGOUT_UBX_TIM_TM2_I2C,
+    UBX_KEY_MSGOUT_UBX_TIM_TM2_SPI,
+    UBX_KEY_MSGOUT_UBX_TIM_TM2_UART1,
+    UBX_KEY_MSGOUT_UBX_TIM_TM2_UART2,
+    UBX_KEY_MSGOUT_UBX_TIM_TM2_USB,
+    UBX_KEY_MSGOUT_UBX_TIM_TP_I2C,
+    UBX_KEY_MSGOUT_UBX_TIM_TP_SPI,
+    UBX_KEY_MSGOUT_UBX_TIM_TP_UART1,
+    UBX_KEY_MSGOUT_UBX_TIM_TP_UART2,
+    UBX_KEY_MSGOUT_UBX_TIM_TP_USB,
+    UBX_KEY_MSGOUT_UBX_TIM_VRFY_I2C,
+    UBX_KEY_MSGOUT_UBX_TIM_VRFY_SPI,
+    UBX_KEY_MSGOUT_UBX_TIM_VRFY_UART1,
+    UBX_KEY_MSGOUT_UBX_TIM_VRFY_UART2,
+    UBX_KEY_MSGOUT_UBX_TIM_VRFY_USB,
+    UBX_KEY_NAVHPG_DGNSSMODE,
+    UBX_KEY_NAVSPG_ACKAIDING,
+    UBX_KEY_NAVSPG_CONSTR_ALT,
+    UBX_KEY_NAVSPG_CONSTR_ALTVAR,
+    UBX_KEY_NAVSPG_CONSTR_DGNSSTO,
+    UBX_KEY_NAVSPG_DYNMODEL,
+    UBX_KEY_NAVSPG_FIXMODE,
+    UBX_KEY_NAVSPG_INFIL_CNOTHRS,
+    UBX_KEY_NAVSPG_INFIL_MAXSVS,
+    UBX_KEY_NAVSPG_INFIL_MINCNO,
+    UBX_KEY_NAVSPG_INFIL_MINELEV,
+    UBX_KEY_NAVSPG_INFIL_MINSVS,
+    UBX_KEY_NAVSPG_INFIL_NCNOTHRS,
+    UBX_KEY_NAVSPG_INIFIX3D,
+    UBX_KEY_NAVSPG_OUTFIL_FACC,
+    UBX_KEY_NAVSPG_OUTFIL_PACC,
+    UBX_KEY_NAVSPG_OUTFIL_PDOP,
+    UBX_KEY_NAVSPG_OUTFIL_TACC,
+    UBX_KEY_NAVSPG_OUTFIL_TDOP,
+    UBX_KEY_NAVSPG_USE_PPP,
+    UBX_KEY_NAVSPG_USE_USRDAT,
+    UBX_KEY_NAVSPG_USRDAT_DX,
+    UBX_KEY_NAVSPG_USRDAT_DY,
+    UBX_KEY_NAVSPG_USRDAT_DZ,
+    UBX_KEY_NAVSPG_USRDAT_FLAT,
+    UBX_KEY_NAVSPG_USRDAT_MAJA,
+    UBX_KEY_NAVSPG_USRDAT_ROTX,
+    UBX_KEY_NAVSPG_USRDAT_ROTY,
+    UBX_KEY_NAVSPG_USRDAT_ROTZ,
+    UBX_KEY_NAVSPG_USRDAT_SCALE,
+    UBX_KEY_NAVSPG_UTCSTANDARD,
+    UBX_KEY_NAVSPG_WKNROLLOVER,
+    UBX_KEY_NMEA_BDSTALKERID,
+    UBX_KEY_NMEA_COMPAT,
+    UBX_KEY_NMEA_CONSIDER,
+    UBX_KEY_NMEA_FILT_BDS,
+    UBX_KEY_NMEA_FILT_GLO,
+    UBX_KEY_NMEA_FILT_GPS,
+    UBX_KEY_NMEA_FILT_QZSS,
+    UBX_KEY_NMEA_FILT_SBAS,
+    UBX_KEY_NMEA_GSVTALKERID,
+    UBX_KEY_NMEA_HIGHPREC,
+    UBX_KEY_NMEA_LIMIT82,
+    UBX_KEY_NMEA_MAINTALKERID,
+    UBX_KEY_NMEA_MAXSVS,
+    UBX_KEY_NMEA_OUT_FROZENCOG,
+    UBX_KEY_NMEA_OUT_INVDATE,
+    UBX_KEY_NMEA_OUT_INVFIX,
+    UBX_KEY_NMEA_OUT_INVTIME,
+    UBX_KEY_NMEA_OUT_MSKFIX,
+    UBX_KEY_NMEA_OUT_ONLYGPS,
+    UBX_KEY_NMEA_PROTVER,
+    UBX_KEY_NMEA_SVNUMBERING,
+    UBX_KEY_ODO_COGLPGAIN,
+    UBX_KEY_ODO_COGMAXPOSACC,
+    UBX_KEY_ODO_COGMAXSPEED,
+    UBX_KEY_ODO_OUTLPCOG,
+    UBX_KEY_ODO_OUTLPVEL,
+    UBX_KEY_ODO_PROFILE,
+    UBX_KEY_ODO_USE_COG,
+    UBX_KEY_ODO_USE_ODO,
+    UBX_KEY_ODO_VELLPGAIN,
+    UBX_KEY_RATE_MEAS,
+    UBX_KEY_RATE_NAV,
+    UBX_KEY_RATE_TIMEREF,
+    UBX_KEY_RINV_BINARY,
+    UBX_KEY_RINV_CHUNK0,
+    UBX_KEY_RINV_CHUNK1,
+    UBX_KEY_RINV_CHUNK2,
+    UBX_KEY_RINV_CHUNK3,
+    UBX_KEY_RINV_DATA_SIZE,
+    UBX_KEY_RINV_DUMP,
+    UBX_KEY_SBAS_PRNSCANMASK,
+    UBX_KEY_SBAS_USE_DIFFCORR,
+    UBX_KEY_SBAS_USE_INTEGRITY,
+    UBX_KEY_SBAS_USE_RANGING,
+    UBX_KEY_SBAS_USE_TESTMODE,
+    UBX_KEY_SIGNAL_BDS_B1_ENA,
+    UBX_KEY_SIGNAL_BDS_B2_ENA,
+    UBX_KEY_SIGNAL_BDS_ENA,
+    UBX_KEY_SIGNAL_GAL_E1_ENA,
+    UBX_KEY_SIGNAL_GAL_E5B_ENA,
+    UBX_KEY_SIGNAL_GAL_ENA,
+    UBX_KEY_SIGNAL_GLO_ENA,
+    UBX_KEY_SIGNAL_GLO_L1_ENA,
+    UBX_KEY_SIGNAL_GLO_L2_ENA,
+    UBX_KEY_SIGNAL_GPS_ENA,
+    UBX_KEY_SIGNAL_GPS_L1CA_ENA,
+    UBX_KEY_SIGNAL_GPS_L2C_ENA,
+    UBX_KEY_SIGNAL_QZSS_ENA,
+    UBX_KEY_SIGNAL_QZSS_L1CA_ENA,
+    UBX_KEY_SIGNAL_QZSS_L1S_ENA,
+    UBX_KEY_SIGNAL_QZSS_L2C_ENA,
+    UBX_KEY_SIGNAL_SBAS_ENA,
+    UBX_KEY_SIGNAL_SBAS_L1CA_ENA,
+    UBX_KEY_SPI_CPHASE,
+    UBX_KEY_SPI_CPOLARITY,
+    UBX_KEY_SPI_ENABLED,
+    UBX_KEY_SPI_EXTENDEDTIMEOUT,
+    UBX_KEY_SPI_MAXFF,
+    UBX_KEY_SPIINPROT_NMEA,
+    UBX_KEY_SPIINPROT_RTCM2X,
+    UBX_KEY_SPIINPROT_RTCM3X,
+    UBX_KEY_SPIINPROT_UBX,
+    UBX_KEY_SPIOUTPROT_NMEA,
+    UBX_KEY_SPIOUTPROT_RTCM3X,
+    UBX_KEY_SPIOUTPROT_UBX,
+    UBX_KEY_TMODE_ECEF_X,
+    UBX_KEY_TMODE_ECEF_X_HP,
+    UBX_KEY_TMODE_ECEF_Y,
+    UBX_KEY_TMODE_ECEF_Y_HP,
+    UBX_KEY_TMODE_ECEF_Z,
+    UBX_KEY_TMODE_ECEF_Z_HP,
+    UBX_KEY_TMODE_FIXED_POS_ACC,
+    UBX_KEY_TMODE_HEIGHT,
+    UBX_KEY_TMODE_HEIGHT_HP,
+    UBX_KEY_TMODE_LAT,
+    UBX_KEY_TMODE_LAT_HP,
+    UBX_KEY_TMODE_LON,
+    UBX_KEY_TMODE_LON_HP,
+    UBX_KEY_TMODE_MODE,
+    UBX_KEY_TMODE_POS_TYPE,
+    UBX_KEY_TMODE_SVIN_ACC_LIMIT,
+    UBX_KEY_TMODE_SVIN_MIN_DUR,
+    UBX_KEY_TP_ALIGN_TO_TOW_TP1,
+    UBX_KEY_TP_ALIGN_TO_TOW_TP2,
+    UBX_KEY_TP_ANT_CABLEDELAY,
+    UBX_KEY_TP_DUTY_LOCK_TP1,
+    UBX_KEY_TP_DUTY_LOCK_TP2,
+    UBX_KEY_TP_DUTY_TP1,
+    UBX_KEY_TP_DUTY_TP2,
+    UBX_KEY_TP_FREQ_LOCK_TP1,
+    UBX_KEY_TP_FREQ_LOCK_TP2,
+    UBX_KEY_TP_FREQ_TP1,
+    UBX_KEY_TP_FREQ_TP2,
+    UBX_KEY_TP_LEN_LOCK_TP1,
+    UBX_KEY_TP_LEN_LOCK_TP2,
+    UBX_KEY_TP_LEN_TP1,
+    UBX_KEY_TP_LEN_TP2,
+    UBX_KEY_TP_PERIOD_LOCK_TP1,
+    UBX_KEY_TP_PERIOD_LOCK_TP2,
+    UBX_KEY_TP_PERIOD_TP1,
+    UBX_KEY_TP_PERIOD_TP2,
+    UBX_KEY_TP_POL_TP1,
+    UBX_KEY_TP_POL_TP2,
+    UBX_KEY_TP_PULSE_DEF,
+    UBX_KEY_TP_PULSE_LENGTH_DEF,
+    UBX_KEY_TP_SYNC_GNSS_TP1,
+    UBX_KEY_TP_SYNC_GNSS_TP2,
+    UBX_KEY_TP_TIMEGRID_TP1,
+    UBX_KEY_TP_TIMEGRID_TP2,
+    UBX_KEY_TP_TP1_ENA,
+    UBX_KEY_TP_TP2_ENA,
+    UBX_KEY_TP_USER_DELAY_TP1,
+    UBX_KEY_TP_USER_DELAY_TP2,
+    UBX_KEY_TP_USE_LOCKED_TP1,
+    UBX_KEY_TP_USE_LOCKED_TP2,
+    UBX_KEY_UART1_BAUDRATE,
+    UBX_KEY_UART1_DATABITS,
+    UBX_KEY_UART1_ENABLED,
+    UBX_KEY_UART1_PARITY,
+    UBX_KEY_UART1_STOPBITS,
+    UBX_KEY_UART1INPROT_NMEA,
+    UBX_KEY_UART1INPROT_RTCM2X,
+    UBX_KEY_UART1INPROT_RTCM3X,
+    UBX_KEY_UART1INPROT_UBX,
+    UBX_KEY_UART1OUTPROT_NMEA,
+    UBX_KEY_UART1OUTPROT_RTCM3X,
+    UBX_KEY_UART1OUTPROT_UBX,
+    UBX_KEY_UART2_BAUDRATE,
+    UBX_KEY_UART2_DATABITS,
+    UBX_KEY_UART2_ENABLED,
+    UBX_KEY_UART2_PARITY,
+    UBX_KEY_UART2_REMAP,
+    UBX_KEY_UART2_STOPBITS,
+    UBX_KEY_UART2INPROT_NMEA,
+    UBX_KEY_UART2INPROT_RTCM2X,
+    UBX_KEY_UART2INPROT_RTCM3X,
+    UBX_KEY_UART2INPROT_UBX,
+    UBX_KEY_UART2OUTPROT_NMEA,
+    UBX_KEY_UART2OUTPROT_RTCM3X,
+    UBX_KEY_UART2OUTPROT_UBX,
+    UBX_KEY_USB_ENABLED,
+    UBX_KEY_USB_POWER,
+    UBX_KEY_USB_PRODUCT_ID,
+    UBX_KEY_USB_PRODUCT_STR0,
+    UBX_KEY_USB_PRODUCT_STR1,
+    UBX_KEY_USB_PRODUCT_STR2,
+    UBX_KEY_USB_PRODUCT_STR3,
+    UBX_KEY_USB_SELFPOW,
+    UBX_KEY_USB_SERIAL_NO_STR0,
+    UBX_KEY_USB_SERIAL_NO_STR1,
+    UBX_KEY_USB_SERIAL_NO_STR2,
+    UBX_KEY_USB_SERIAL_NO_STR3,
+    UBX_KEY_USB_VENDOR_ID,
+    UBX_KEY_USB_VENDOR_STR0,
+    UBX_KEY_USB_VENDOR_STR1,
+    UBX_KEY_USB_VENDOR_STR2,
+    UBX_KEY_USB_VENDOR_STR3,
+    UBX_KEY_USBINPROT_NMEA,
+    UBX_KEY_USBINPROT_RTCM2X,
+    UBX_KEY_USBINPROT_RTCM3X,
+    UBX_KEY_USBINPROT_UBX,
+    UBX_KEY_USBOUTPROT_NMEA,
+    UBX_KEY_USBOUTPROT_RTCM3X,
+    UBX_KEY_USBOUTPROT_UBX,
+    UBX_KEY_COUNT
+} ubx_key_t;
+
+typedef struct
+{
+    const char* name;
+    uint32_t id;
+    ubx_val_t type;
+} ubx_key_info_t;
+
+extern const ubx_key_info_t ubx_keys[UBX_KEY_COUNT];
+
+#endif  // ESP32S3_GNSS_UBX_KEYS_H
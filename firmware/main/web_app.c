@@ -8,8 +8,15 @@
 #include <mdns.h>
 #include <string.h>
 
+#include "base.h"
+#include "boot.h"
 #include "config.h"
+#include "latency.h"
+#include "ntrip_caster.h"
 #include "ntrip_client.h"
+#include "rtcm3_pool.h"
+#include "rtcm3_stats.h"
+#include "sdlog.h"
 #include "status.h"
 #include "uart.h"
 #include "util.h"
@@ -21,6 +28,7 @@
 #define FILE_HASH_SUFFIX           ".crc"
 #define FILE_BUFFER_SIZE           2048
 #define REQ_BUFFER_SIZE            256
+#define STATS_BUFFER_SIZE          4096
 #define IS_FILE_EXT(filename, ext) (strcasecmp(&filename[strlen(filename) - sizeof(ext) + 1], ext) == 0)
 
 static const char* TAG = "WEB_APP";
@@ -34,7 +42,7 @@ static esp_err_t spiffs_init()
     err = esp_vfs_spiffs_register(&conf);
     ERROR_IF(err != ESP_OK, return err, "Cannot register SPIFFS");
 
-    vTaskDelay(pdMS_TO_TICKS(1000));
+    // registering mounts the partition, nothing to wait for
     ERROR_IF(!esp_spiffs_mounted(WWW_PARTITION), return ESP_FAIL, "SPIFFS partition is not mounted")
 
     return ESP_OK;
@@ -127,6 +135,84 @@ static esp_err_t config_get_handler(httpd_req_t* req)
     return err;
 }
 
+static esp_err_t stats_get_handler(httpd_req_t* req)
+{
+    esp_err_t err = ESP_OK;
+    err = httpd_resp_set_type(req, "text/plain");
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    char* query = calloc(32, sizeof(char));
+    if (query == NULL)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    err = httpd_req_get_url_query_str(req, query, 32);
+    if (err != ESP_OK)
+    {
+        query[0] = '\0';
+    }
+
+    char* buffer = calloc(STATS_BUFFER_SIZE, sizeof(char));
+    if (buffer == NULL)
+    {
+        free(query);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // each group is a list of key=value lines
+    size_t len = 0;
+    if (strcmp(query, "uart") == 0)
+    {
+        len = uart_stats_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else if (strcmp(query, "pool") == 0)
+    {
+        len = rtcm3_pool_stats_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else if (strcmp(query, "caster") == 0)
+    {
+        len = ntrip_caster_stats_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else if (strcmp(query, "gnss") == 0)
+    {
+        len = status_gnss_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else if (strcmp(query, "rtcm3") == 0)
+    {
+        len = rtcm3_stats_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else if (strcmp(query, "sky") == 0)
+    {
+        len = status_sky_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else if (strcmp(query, "latency") == 0)
+    {
+        len = latency_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else if (strcmp(query, "boot") == 0)
+    {
+        len = boot_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else if (strcmp(query, "sdlog") == 0)
+    {
+        len = sdlog_stats_print(buffer, STATS_BUFFER_SIZE);
+    }
+    else
+    {
+        free(buffer);
+        free(query);
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Unknown stats group");
+    }
+
+    err = httpd_resp_send(req, buffer, len);
+    free(buffer);
+    free(query);
+    return err;
+}
+
 static esp_err_t action_post_handler(httpd_req_t* req)
 {
     // allocate a buffer for content of HTTP POST request
@@ -156,6 +242,8 @@ static esp_err_t action_post_handler(httpd_req_t* req)
     // process request
     char* args[32];
     int narg = 0;
+    uint32_t job = 0;
+    const char* job_error = NULL;
     char* buffer_ptr = buffer;
     while ((narg < 32) && ((args[narg] = strsep(&buffer_ptr, NEWLINE)) != NULL))
     {
@@ -220,12 +308,17 @@ static esp_err_t action_post_handler(httpd_req_t* req)
     }
     else if (strcmp(args[0], "gnss_mode_set_rover") == 0)
     {
-        ubx_set_mode_rover();
+        base_forget();
+        job = ubx_set_mode_rover();
+        job_error = "Cannot start GNSS mode change";
     }
     else if (strcmp(args[0], "gnss_mode_set_survey") == 0)
     {
         REQUIRE_ARGS(3);
-        ubx_set_mode_survey(args[1], args[2]);
+        // the new survey replaces the saved one once it completes
+        base_forget();
+        job = ubx_set_mode_survey(args[1], args[2]);
+        job_error = "Cannot start GNSS mode change";
     }
     else if (strcmp(args[0], "gnss_mode_set_fixed") == 0)
     {
@@ -235,8 +328,30 @@ static esp_err_t action_post_handler(httpd_req_t* req)
         config_set(CONFIG_BASE_LAT, args[1]);
         config_set(CONFIG_BASE_LON, args[2]);
         config_set(CONFIG_BASE_ALT, args[3]);
+        base_forget();
 
-        ubx_set_mode_fixed(args[1], args[2], args[3]);
+        job = ubx_set_mode_fixed(args[1], args[2], args[3]);
+        job_error = "Cannot start GNSS mode change";
+    }
+    else if (strcmp(args[0], "rtcm3_profile_set") == 0)
+    {
+        REQUIRE_ARGS(2);
+
+        // an unknown profile starts no job and is not saved
+        job = ubx_set_profile(args[1]);
+        job_error = "Cannot start RTCM3 profile change";
+        if (job != 0)
+        {
+            config_set(CONFIG_RTCM3_PROFILE, args[1]);
+        }
+    }
+    else if (strcmp(args[0], "gnss_raw_capture") == 0)
+    {
+        REQUIRE_ARGS(2);
+
+        // not saved, a capture ends with a restart
+        job = ubx_set_raw_capture(strcmp(args[1], "1") == 0);
+        job_error = "Cannot start raw capture change";
     }
     else if (strcmp(args[0], "wifi_connect") == 0)
     {
@@ -256,13 +371,26 @@ static esp_err_t action_post_handler(httpd_req_t* req)
     }
     else if (strcmp(args[0], "system_save") == 0)
     {
-        REQUIRE_ARGS(CONFIG_MAX + 1);
+        REQUIRE_ARGS(CONFIG_TUNING_START + 1);
 
-        for (size_t type = CONFIG_NVS_START; type < CONFIG_MAX; type++)
+        for (size_t type = CONFIG_NVS_START; type < CONFIG_TUNING_START; type++)
         {
             config_set(type, args[type + 1]);
         }
     }
+    else if (strcmp(args[0], "config_set") == 0)
+    {
+        REQUIRE_ARGS(3);
+
+        // only tuning keys can be set by name
+        config_t type = config_find(args[1]);
+        if (type < CONFIG_TUNING_START || type >= CONFIG_MAX)
+        {
+            free(buffer);
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Unknown config key");
+        }
+        config_set(type, args[2]);
+    }
     else if (strcmp(args[0], "system_restart") == 0)
     {
         esp_restart();
@@ -279,6 +407,19 @@ static esp_err_t action_post_handler(httpd_req_t* req)
 
 #undef REQUIRE_ARGS
 
+    // mode, profile and raw capture changes run in the background, the reply names the job reported in gnss_mode_job status
+    if (job_error != NULL)
+    {
+        free(buffer);
+        if (job == 0)
+        {
+            return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, job_error);
+        }
+        char reply[16];
+        snprintf(reply, sizeof(reply), "%lu", job);
+        return httpd_resp_sendstr(req, reply);
+    }
+
     // end
     free(buffer);
     return httpd_resp_sendstr(req, "OK");
@@ -507,6 +648,13 @@ httpd_uri_t _config_get_handler = {
     .user_ctx = NULL,
 };
 
+httpd_uri_t _stats_get_handler = {
+    .uri = "/stats",
+    .method = HTTP_GET,
+    .handler = stats_get_handler,
+    .user_ctx = NULL,
+};
+
 httpd_uri_t _action_post_handler = {
     .uri = "/action",
     .method = HTTP_POST,
@@ -543,6 +691,7 @@ static esp_err_t server_init()
 
     httpd_register_uri_handler(server, &_status_get_handler);
     httpd_register_uri_handler(server, &_config_get_handler);
+    httpd_register_uri_handler(server, &_stats_get_handler);
     httpd_register_uri_handler(server, &_action_post_handler);
     httpd_register_uri_handler(server, &_file_get_handler);
 
@@ -0,0 +1,94 @@
+import csv
+import re
+
+keys_file = r'scripts/ubx_keys.csv'
+header_file = r'main/ubx_keys.h'
+source_file = r'main/ubx_keys.c'
+
+# value types, numbered like the ubx message field types in ublox.c
+types = ["U1", "U2", "U4", "U8", "I1", "I2", "I4", "R4", "R8"]
+
+
+def enum_name(name):
+    """Map a key name such as MSGOUT-UBX_NAV_PVT_UART1 to its C enumerator"""
+    return "UBX_KEY_" + re.sub(r'[^A-Za-z0-9]', '_', name).upper()
+
+
+def write_if_changed(filename, content):
+    """Keep the timestamp of an unchanged file so the prebuild step does not force a rebuild"""
+    try:
+        with open(filename, "r") as f:
+            if f.read() == content:
+                return
+    except FileNotFoundError:
+        pass
+    print(f"Generating {filename}")
+    with open(filename, "w") as f:
+        f.write(content)
+
+
+keys = {}
+enums = set()
+with open(keys_file, "r") as f:
+    for line, row in enumerate(csv.reader(f), 1):
+        if not row or row[0].startswith("#"):
+            continue
+        if len(row) != 3:
+            raise SystemExit(f"{keys_file}:{line}: expected name,key id,type")
+        name, key_id, key_type = (field.strip() for field in row)
+        if name in keys or enum_name(name) in enums:
+            raise SystemExit(f"{keys_file}:{line}: duplicated key {name}")
+        if key_type not in types:
+            raise SystemExit(f"{keys_file}:{line}: unknown type {key_type}")
+        keys[name] = (int(key_id, 16), key_type)
+        enums.add(enum_name(name))
+
+# the enum order is the table order, sorted by name for a binary search with strcmp
+names = sorted(keys, key=lambda name: name.encode())
+
+header = []
+header.append("// generated by scripts/gen_ubx_keys.py from scripts/ubx_keys.csv, do not edit")
+header.append("#ifndef ESP32S3_GNSS_UBX_KEYS_H")
+header.append("#define ESP32S3_GNSS_UBX_KEYS_H")
+header.append("")
+header.append("#include <stdint.h>")
+header.append("")
+header.append("typedef enum")
+header.append("{")
+for i, key_type in enumerate(types):
+    header.append(f"    UBX_VAL_{key_type}{' = 1' if i == 0 else ''},")
+header.append("} ubx_val_t;")
+header.append("")
+header.append("// configuration keys without the CFG- prefix, in name order")
+header.append("typedef enum")
+header.append("{")
+for name in names:
+    header.append(f"    {enum_name(name)},")
+header.append("    UBX_KEY_COUNT")
+header.append("} ubx_key_t;")
+header.append("")
+header.append("typedef struct")
+header.append("{")
+header.append("    const char* name;")
+header.append("    uint32_t id;")
+header.append("    ubx_val_t type;")
+header.append("} ubx_key_info_t;")
+header.append("")
+header.append("extern const ubx_key_info_t ubx_keys[UBX_KEY_COUNT];")
+header.append("")
+header.append("#endif  // ESP32S3_GNSS_UBX_KEYS_H")
+header.append("")
+
+source = []
+source.append("// generated by scripts/gen_ubx_keys.py from scripts/ubx_keys.csv, do not edit")
+source.append("#include \"ubx_keys.h\"")
+source.append("")
+source.append("const ubx_key_info_t ubx_keys[UBX_KEY_COUNT] = {")
+for name in names:
+    key_id, key_type = keys[name]
+    source.append(f"    [{enum_name(name)}] = {{\"{name}\", 0x{key_id:08x}, UBX_VAL_{key_type}}},")
+source.append("};")
+source.append("")
+
+write_if_changed(header_file, "\n".join(header))
+write_if_changed(source_file, "\n".join(source))
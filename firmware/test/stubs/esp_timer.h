@@ -0,0 +1,15 @@
+#ifndef ESP32S3_GNSS_TEST_ESP_TIMER_H
+#define ESP32S3_GNSS_TEST_ESP_TIMER_H
+
+#include <stdint.h>
+#include <time.h>
+
+// us since an arbitrary start, monotonic as on the chip
+static inline int64_t esp_timer_get_time()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+#endif  // ESP32S3_GNSS_TEST_ESP_TIMER_H
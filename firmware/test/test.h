@@ -0,0 +1,34 @@
+#ifndef ESP32S3_GNSS_TEST_H
+#define ESP32S3_GNSS_TEST_H
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// checks keep going after a failure, main returns the result
+static int test_failures = 0;
+
+#define CHECK(condition)                                                         \
+    do                                                                           \
+    {                                                                            \
+        if (!(condition))                                                        \
+        {                                                                        \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            test_failures++;                                                     \
+        }                                                                        \
+    } while (0)
+
+#define TEST_RESULT() (test_failures == 0 ? 0 : 1)
+
+// benchmarks only run with "bench" as the first argument, ctest runs the checks
+#define TEST_BENCH(argc, argv) ((argc) > 1 && strcmp((argv)[1], "bench") == 0)
+
+// s of CPU time used by the process
+static inline double test_cpu_s()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+#endif  // ESP32S3_GNSS_TEST_H
@@ -0,0 +1,146 @@
+#include <stdlib.h>
+
+#include "test.h"
+#include "ublox.h"
+
+// reference implementation, one bit at a time as in RTCM 10403
+static uint32_t crc24q_bitwise(const uint8_t* buff, size_t len)
+{
+    uint32_t crc = 0;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= (uint32_t)buff[i] << 16;
+        for (int j = 0; j < 8; j++)
+        {
+            crc <<= 1;
+            if (crc & 0x1000000)
+            {
+                crc ^= 0x1864CFB;
+            }
+        }
+    }
+    return crc & 0xFFFFFF;
+}
+
+static uint32_t table[4][256];
+
+static void table_init()
+{
+    for (int i = 0; i < 256; i++)
+    {
+        table[0][i] = crc24q_bitwise((const uint8_t[]){i}, 1) << 8;
+    }
+    for (int k = 1; k < 4; k++)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            table[k][i] = (table[k - 1][i] << 8) ^ table[0][table[k - 1][i] >> 24];
+        }
+    }
+}
+
+// one table lookup per byte, as in RTKLIB
+static uint32_t crc24q_bytewise(const uint8_t* buff, size_t len)
+{
+    uint32_t crc = 0;
+
+    while (len--)
+    {
+        crc = (crc << 8) ^ table[0][(crc >> 24) ^ *buff++];
+    }
+    return crc >> 8;
+}
+
+static uint32_t crc24q_slice4(const uint8_t* buff, size_t len)
+{
+    uint32_t crc = 0, a;
+
+    while (len >= 4)
+    {
+        a = crc ^ (((uint32_t)buff[0] << 24) | ((uint32_t)buff[1] << 16) | ((uint32_t)buff[2] << 8) | buff[3]);
+        crc = table[3][a >> 24] ^ table[2][(a >> 16) & 0xFF] ^ table[1][(a >> 8) & 0xFF] ^ table[0][a & 0xFF];
+        buff += 4;
+        len -= 4;
+    }
+    while (len--)
+    {
+        crc = (crc << 8) ^ table[0][(crc >> 24) ^ *buff++];
+    }
+    return crc >> 8;
+}
+
+static void test_vectors()
+{
+    const uint8_t check[] = "123456789";
+    uint8_t buff[300];
+
+    // the check value of CRC-24/LTE-A, which is the same polynomial without reflection or xor
+    CHECK(crc24q(check, 9) == 0xCDE703);
+    CHECK(crc24q_bitwise(check, 9) == 0xCDE703);
+    CHECK(crc24q(check, 0) == 0);
+
+    // every length around the 8 byte slices, and every alignment of the start
+    srand(1);
+    for (size_t i = 0; i < sizeof(buff); i++)
+    {
+        buff[i] = rand();
+    }
+    for (size_t len = 0; len < 64; len++)
+    {
+        for (size_t start = 0; start < 8; start++)
+        {
+            CHECK(crc24q(buff + start, len) == crc24q_bitwise(buff + start, len));
+        }
+    }
+    CHECK(crc24q(buff, sizeof(buff)) == crc24q_bitwise(buff, sizeof(buff)));
+    CHECK(crc24q_slice4(buff, sizeof(buff)) == crc24q_bitwise(buff, sizeof(buff)));
+    CHECK(crc24q_bytewise(buff, sizeof(buff)) == crc24q_bitwise(buff, sizeof(buff)));
+}
+
+// MSM7 sized frames, the CRC covers header and payload
+static void bench_crc24q()
+{
+    static const struct
+    {
+        const char* name;
+        uint32_t (*crc)(const uint8_t* buff, size_t len);
+        int rounds;
+    } KERNELS[] = {{"bitwise", crc24q_bitwise, 20}, {"byte table", crc24q_bytewise, 200}, {"slice-by-4", crc24q_slice4, 400}, {"slice-by-8", crc24q, 400}};
+    const size_t FRAMES = 1000, FRAME_LEN = 483;
+
+    uint8_t* frames = malloc(FRAMES * FRAME_LEN);
+    for (size_t i = 0; i < FRAMES * FRAME_LEN; i++)
+    {
+        frames[i] = rand();
+    }
+
+    for (size_t k = 0; k < sizeof(KERNELS) / sizeof(KERNELS[0]); k++)
+    {
+        uint32_t sum = 0;
+        double start = test_cpu_s();
+        for (int round = 0; round < KERNELS[k].rounds; round++)
+        {
+            for (size_t i = 0; i < FRAMES; i++)
+            {
+                sum += KERNELS[k].crc(frames + i * FRAME_LEN, FRAME_LEN);
+            }
+        }
+        double s = test_cpu_s() - start;
+        printf("crc24q %-10s: %7.1f MB/s (%08X)\n", KERNELS[k].name, KERNELS[k].rounds * FRAMES * FRAME_LEN / s / 1e6, sum);
+    }
+    free(frames);
+}
+
+int main(int argc, char* argv[])
+{
+    table_init();
+    test_vectors();
+
+    if (TEST_BENCH(argc, argv))
+    {
+        bench_crc24q();
+    }
+
+    return TEST_RESULT();
+}
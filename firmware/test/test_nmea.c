@@ -0,0 +1,320 @@
+#include <stdlib.h>
+
+#include "nmea.h"
+#include "test.h"
+
+// the examples found in most NMEA 0183 references, the checksums are the published ones
+static const char GGA[] = "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47";
+static const char RMC[] = "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A";
+static const char GST[] = "$GPGST,172814.0,0.006,0.023,0.020,273.6,0.023,0.020,0.031*6A";
+
+// "$" body "*hh" with the checksum computed, returns the length
+static size_t make_nmea(char* line, const char* body)
+{
+    uint8_t checksum = 0;
+    for (const char* c = body; *c; c++)
+    {
+        checksum ^= (uint8_t)*c;
+    }
+    return sprintf(line, "$%s*%02X", body, checksum);
+}
+
+static bool parse(const char* line, nmea_index_t* index)
+{
+    return nmea_parse(line, strlen(line), index);
+}
+
+static void test_checksum()
+{
+    nmea_index_t index;
+    char line[NMEA_LINE_LEN_MAX];
+
+    CHECK(parse(GGA, &index));
+    CHECK(parse(RMC, &index));
+    CHECK(parse(GST, &index));
+
+    // one wrong digit, lowercase hex, missing or short checksum, anything after it
+    strcpy(line, GGA);
+    line[strlen(line) - 1] = '8';
+    CHECK(!parse(line, &index));
+    size_t len = make_nmea(line, "GNTXT,01,01,02,ZZ");
+    CHECK(nmea_parse(line, len, &index));
+    line[len - 2] = line[len - 2] >= 'A' ? line[len - 2] + 32 : line[len - 2];
+    line[len - 1] = line[len - 1] >= 'A' ? line[len - 1] + 32 : line[len - 1];
+    CHECK(nmea_parse(line, len, &index));
+    CHECK(!nmea_parse(line, len - 1, &index));
+    CHECK(!nmea_parse(line, len - 3, &index));
+    CHECK(!parse("$GPGGA,123519", &index));
+    CHECK(!parse("GPGGA,123519*00", &index));
+    CHECK(!parse("$*0", &index));
+    strcpy(line, GGA);
+    strcat(line, "\r");
+    CHECK(!parse(line, &index));
+    CHECK(!parse("$GPTXT*5X", &index));
+
+    // a payload byte that changes the xor
+    strcpy(line, GGA);
+    line[10] = '9';
+    CHECK(!parse(line, &index));
+}
+
+static void test_fields()
+{
+    nmea_index_t index;
+    char line[NMEA_LINE_LEN_MAX];
+    char body[NMEA_LINE_LEN_MAX];
+    const char* field;
+    size_t len;
+
+    CHECK(parse(GGA, &index));
+    CHECK(index.count == 15);
+    field = nmea_field(&index, 0, &len);
+    CHECK(len == 5 && memcmp(field, "GPGGA", 5) == 0);
+    field = nmea_field(&index, 2, &len);
+    CHECK(len == 8 && memcmp(field, "4807.038", 8) == 0);
+    nmea_field(&index, 13, &len);
+    CHECK(len == 0);
+    field = nmea_field(&index, 14, &len);
+    CHECK(len == 0 && field == GGA + strlen(GGA) - 3);
+    field = nmea_field(&index, 15, &len);
+    CHECK(len == 0 && *field == '\0');
+
+    // the talker does not matter, the type does
+    CHECK(nmea_is(&index, "GGA") && !nmea_is(&index, "RMC"));
+    make_nmea(line, "GNGGA,");
+    CHECK(parse(line, &index) && nmea_is(&index, "GGA") && index.count == 2);
+    make_nmea(line, "PUBX,00");
+    CHECK(parse(line, &index) && !nmea_is(&index, "X,0"));
+
+    // NMEA_FIELDS_MAX fields fit, one more does not
+    strcpy(body, "GNXXX");
+    for (int i = 1; i < NMEA_FIELDS_MAX; i++)
+    {
+        strcat(body, ",1");
+    }
+    make_nmea(line, body);
+    CHECK(parse(line, &index) && index.count == NMEA_FIELDS_MAX);
+    strcat(body, ",1");
+    make_nmea(line, body);
+    CHECK(!parse(line, &index));
+}
+
+static void test_gga()
+{
+    nmea_index_t index;
+    nmea_gga_t gga;
+    char line[NMEA_LINE_LEN_MAX];
+
+    CHECK(parse(GGA, &index) && nmea_decode_gga(&index, &gga));
+    CHECK(gga.utc_ms == (12 * 3600 + 35 * 60 + 19) * 1000);
+    CHECK(gga.lat == 48117300000LL);  // 48 deg 7.038 min
+    CHECK(gga.lon == 11516666667LL);  // 11 deg 31 min, rounded to 1e-9
+    CHECK(gga.quality == 1 && gga.num_sv == 8 && gga.hdop == 90);
+    CHECK(gga.hmsl == 5454000 && gga.geoid_sep == 469000);
+
+    // CFG-NMEA-HIGHPREC output of a fixed base in the southern and western hemispheres
+    make_nmea(line, "GNGGA,235959.99,3351.1234567,S,07036.7654321,W,4,31,0.55,-12.3456,M,-24.0999,M,1.0,0000");
+    CHECK(parse(line, &index) && nmea_decode_gga(&index, &gga));
+    CHECK(gga.utc_ms == 86399990);
+    CHECK(gga.lat == -(33000000000LL + (511234567LL * 5 + 1) / 3));
+    CHECK(gga.lon == -(70000000000LL + (367654321LL * 5 + 1) / 3));
+    CHECK(gga.quality == 4 && gga.num_sv == 31 && gga.hdop == 55);
+    CHECK(gga.hmsl == -123456 && gga.geoid_sep == -240999);
+
+    // digits beyond the kept precision are dropped, not rounded
+    make_nmea(line, "GNGGA,000000.00,0000.000000099,N,00000.0000001,E,5,12,1.00,0.00001,M,0.0,M,,");
+    CHECK(parse(line, &index) && nmea_decode_gga(&index, &gga));
+    CHECK(gga.lat == 0 && gga.lon == (1 * 5 + 1) / 3 && gga.hmsl == 0 && gga.quality == 5);
+
+    // no fix: only time and quality, the empty fields are fine and nothing of an earlier fix is left
+    make_nmea(line, "GNGGA,010203.00,,,,,0,00,99.99,,,,,,");
+    memset(&gga, 0x5A, sizeof(gga));
+    CHECK(parse(line, &index) && nmea_decode_gga(&index, &gga));
+    CHECK(gga.quality == 0 && gga.utc_ms == 3723000);
+    CHECK(gga.lat == 0 && gga.lon == 0 && gga.num_sv == 0 && gga.hdop == 0 && gga.hmsl == 0 && gga.geoid_sep == 0);
+
+    // a fix with a field missing or malformed is rejected
+    make_nmea(line, "GNGGA,010203.00,4807.038,N,,E,1,08,0.9,545.4,M,46.9,M,,");
+    CHECK(parse(line, &index) && !nmea_decode_gga(&index, &gga));
+    make_nmea(line, "GNGGA,010203.00,4807.038,X1,01131.000,E,1,08,0.9,545.4,M,46.9,M,,");
+    CHECK(parse(line, &index) && !nmea_decode_gga(&index, &gga));
+    make_nmea(line, "GNGGA,010203.00,4807.038,N,01131.000,E,1,08,0.9x,545.4,M,46.9,M,,");
+    CHECK(parse(line, &index) && !nmea_decode_gga(&index, &gga));
+    make_nmea(line, "GNGGA,010203.00,-4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,");
+    CHECK(parse(line, &index) && !nmea_decode_gga(&index, &gga));
+    make_nmea(line, "GNGGA,010203.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M");
+    CHECK(parse(line, &index) && !nmea_decode_gga(&index, &gga));
+    CHECK(parse(RMC, &index) && !nmea_decode_gga(&index, &gga));
+}
+
+static void test_gst_rmc()
+{
+    nmea_index_t index;
+    nmea_gst_t gst;
+    nmea_rmc_t rmc;
+    char line[NMEA_LINE_LEN_MAX];
+
+    CHECK(parse(GST, &index) && nmea_decode_gst(&index, &gst));
+    CHECK(gst.utc_ms == (17 * 3600 + 28 * 60 + 14) * 1000);
+    CHECK(gst.rms == 6 && gst.sigma_lat == 23 && gst.sigma_lon == 20 && gst.sigma_alt == 31);
+
+    // the receiver leaves the range rms and the ellipse empty
+    make_nmea(line, "GNGST,082356.00,,,,,0.0123,0.0456,1.2");
+    CHECK(parse(line, &index) && nmea_decode_gst(&index, &gst));
+    CHECK(gst.rms == 0 && gst.sigma_lat == 12 && gst.sigma_lon == 45 && gst.sigma_alt == 1200);
+    make_nmea(line, "GNGST,082356.00,,,,,0.0123,,1.2");
+    CHECK(parse(line, &index) && !nmea_decode_gst(&index, &gst));
+
+    CHECK(parse(RMC, &index) && nmea_decode_rmc(&index, &rmc));
+    CHECK(rmc.valid && rmc.utc_ms == (12 * 3600 + 35 * 60 + 19) * 1000);
+    CHECK(rmc.lat == 48117300000LL && rmc.lon == 11516666667LL);
+    CHECK(rmc.speed == 22400 && rmc.course == 8440 && rmc.date == 230394);
+    CHECK(rmc.mode == 'N');  // NMEA 2.3 added the mode after the variation
+
+    make_nmea(line, "GNRMC,082356.00,A,4807.0380000,N,01131.0000000,E,0.012,,161026,,,R,V");
+    CHECK(parse(line, &index) && nmea_decode_rmc(&index, &rmc));
+    CHECK(rmc.valid && rmc.speed == 12 && rmc.course == 0 && rmc.date == 161026 && rmc.mode == 'R');
+
+    // a void fix carries only time and date
+    make_nmea(line, "GNRMC,082356.00,V,,,,,,,161026,,,N,V");
+    CHECK(parse(line, &index) && nmea_decode_rmc(&index, &rmc));
+    CHECK(!rmc.valid && rmc.date == 161026 && rmc.mode == 'N');
+}
+
+// mutations of valid sentences: the parser must stay inside len and never accept a wrong checksum
+static void test_fuzz()
+{
+    static const char* BODIES[] = {
+        "GNGGA,235959.99,3351.1234567,S,07036.7654321,W,4,31,0.55,-12.3456,M,-24.0999,M,1.0,0000",
+        "GNGST,082356.00,1.2,,,,0.0123,0.0456,1.2",
+        "GNRMC,082356.00,A,4807.0380000,N,01131.0000000,E,0.012,,161026,,,R,V",
+        "GNGGA,010203.00,,,,,0,00,99.99,,,,,,",
+    };
+    const int ROUNDS = 200000;
+    uint32_t seed = 1;
+    uint32_t accepted = 0, decoded = 0, wrong = 0;
+    char valid[NMEA_LINE_LEN_MAX];
+    nmea_index_t index;
+    nmea_gga_t gga;
+    nmea_gst_t gst;
+    nmea_rmc_t rmc;
+
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        seed = seed * 1103515245 + 12345;
+        size_t len = make_nmea(valid, BODIES[(seed >> 16) % 4]);
+
+        // an exact size heap copy, so a sanitizer build sees any read past len
+        char* line = malloc(NMEA_LINE_LEN_MAX);
+        memcpy(line, valid, len);
+        int mutations = 1 + (seed >> 8) % 3;
+        for (int m = 0; m < mutations; m++)
+        {
+            seed = seed * 1103515245 + 12345;
+            size_t pos = (seed >> 16) % len;
+            switch ((seed >> 4) % 4)
+            {
+                case 0:
+                    line[pos] ^= 1 << ((seed >> 12) % 8);
+                    break;
+                case 1:
+                    line[pos] = ",*.-$"[(seed >> 12) % 5];
+                    break;
+                case 2:
+                    len = pos + 1;
+                    break;
+                case 3:
+                    if (len < NMEA_LINE_LEN_MAX)
+                    {
+                        memmove(line + pos + 1, line + pos, len - pos);
+                        line[pos] = (seed >> 12) & 0xFF;
+                        len++;
+                    }
+                    break;
+            }
+        }
+        line = realloc(line, len);
+
+        if (nmea_parse(line, len, &index))
+        {
+            // an accepted sentence must be the "$...*hh" the xor says it is
+            uint8_t checksum = 0;
+            size_t star = 1;
+            for (; line[star] != '*'; star++)
+            {
+                checksum ^= (uint8_t)line[star];
+            }
+            char hex[3];
+            sprintf(hex, "%02X", checksum);
+            wrong += star + 3 != len || strncasecmp(line + star + 1, hex, 2) != 0;
+            accepted++;
+
+            if (nmea_decode_gga(&index, &gga) || nmea_decode_gst(&index, &gst) || nmea_decode_rmc(&index, &rmc))
+            {
+                decoded++;
+            }
+        }
+        free(line);
+    }
+
+    // some mutations leave the checksum intact, e.g. a flip in the hex digit's case
+    CHECK(wrong == 0);
+    CHECK(accepted > 0 && accepted < ROUNDS / 4);
+    CHECK(decoded <= accepted);
+}
+
+// the GGA, GST and RMC of one epoch as CFG-NMEA-HIGHPREC prints them
+static void bench_decode()
+{
+    static const char* BODIES[] = {
+        "GNGGA,082356.00,2057.6002401,N,10546.1068803,E,4,31,0.55,12.3456,M,-24.0999,M,1.0,0000",
+        "GNGST,082356.00,0.0089,,,,0.0123,0.0456,0.0789",
+        "GNRMC,082356.00,A,2057.6002401,N,10546.1068803,E,0.012,,161026,,,R,V",
+    };
+    char lines[3][NMEA_LINE_LEN_MAX];
+    size_t lens[3];
+    nmea_index_t index;
+    nmea_gga_t gga;
+    nmea_gst_t gst;
+    nmea_rmc_t rmc;
+    uint32_t decoded = 0;
+    const int ROUNDS = 1000000;
+
+    for (int i = 0; i < 3; i++)
+    {
+        lens[i] = make_nmea(lines[i], BODIES[i]);
+    }
+
+    double start = test_cpu_s();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            if (nmea_parse(lines[i], lens[i], &index) &&
+                (nmea_decode_gga(&index, &gga) || nmea_decode_gst(&index, &gst) || nmea_decode_rmc(&index, &rmc)))
+            {
+                decoded++;
+            }
+        }
+    }
+    double s = test_cpu_s() - start;
+
+    CHECK(decoded == 3 * ROUNDS);
+    printf("nmea parse + decode: %u sentences, %.0f sentences/s, %.2f us/sentence\n", decoded, decoded / s, s / decoded * 1e6);
+}
+
+int main(int argc, char* argv[])
+{
+    test_checksum();
+    test_fields();
+    test_gga();
+    test_gst_rmc();
+    test_fuzz();
+
+    if (TEST_BENCH(argc, argv))
+    {
+        bench_decode();
+    }
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,235 @@
+#include <stdlib.h>
+
+#include "nmea.h"
+#include "test.h"
+#include "ublox.h"
+#include "util.h"
+
+#define SPLITTER_LEN 16384  // UART_STATUS_LINE_BUFFER_LEN
+
+typedef struct
+{
+    int lines;
+    int ubx;
+    char last_line[NMEA_LINE_LEN_MAX];
+    size_t last_ubx_len;
+} result_t;
+
+// feed bytes in blocks of at most block, as uart_status_task does
+static void feed(nmea_splitter_t* splitter, const char* data, size_t len, size_t block, result_t* result)
+{
+    const char* out;
+    size_t out_len, space, n;
+    nmea_split_t type;
+
+    while (len > 0)
+    {
+        char* dst = nmea_splitter_space(splitter, &space);
+        n = MIN(MIN(len, block), space);
+        memcpy(dst, data, n);
+        nmea_splitter_commit(splitter, n);
+        data += n;
+        len -= n;
+
+        while ((type = nmea_splitter_next(splitter, &out, &out_len)) != NMEA_SPLIT_NONE)
+        {
+            if (type == NMEA_SPLIT_LINE)
+            {
+                result->lines++;
+                CHECK(strlen(out) == out_len);
+                memcpy(result->last_line, out, out_len + 1);
+            }
+            else
+            {
+                result->ubx++;
+                result->last_ubx_len = out_len;
+                CHECK(ubx_check_msg((const uint8_t*)out, out_len));
+            }
+        }
+    }
+}
+
+static const char EPOCH[] =
+    "$GNGGA,104548.00,2057.60024,N,10546.10688,E,4,12,0.62,12.3,M,-24.1,M,1.0,0000*5B\r\n"
+    "$GNGST,104548.00,12,0.012,0.008,42.1,0.010,0.009,0.020*7D\r\n"
+    "$GNRMC,104548.00,A,2057.60024,N,10546.10688,E,0.012,,161026,,,R,V*13\r\n";
+
+static void test_lines()
+{
+    nmea_splitter_t splitter;
+
+    for (size_t block = 1; block <= sizeof(EPOCH); block += 5)
+    {
+        result_t result = {0};
+        CHECK(nmea_splitter_init(&splitter, SPLITTER_LEN) == ESP_OK);
+        feed(&splitter, EPOCH, strlen(EPOCH), block, &result);
+        CHECK(result.lines == 3 && splitter.lines == 3);
+        CHECK(strcmp(result.last_line, "$GNRMC,104548.00,A,2057.60024,N,10546.10688,E,0.012,,161026,,,R,V*13") == 0);
+        CHECK(splitter.overflows == 0);
+        nmea_splitter_deinit(&splitter);
+    }
+}
+
+static void test_overlong()
+{
+    nmea_splitter_t splitter;
+    result_t result = {0};
+    char data[2 * NMEA_LINE_LEN_MAX + 64];
+
+    // one line longer than NMEA_LINE_LEN_MAX, then a good one
+    memset(data, 'A', 2 * NMEA_LINE_LEN_MAX);
+    data[0] = '$';
+    strcpy(data + 2 * NMEA_LINE_LEN_MAX, "\r\n$GNTXT,ok*00\r\n");
+
+    CHECK(nmea_splitter_init(&splitter, SPLITTER_LEN) == ESP_OK);
+    feed(&splitter, data, strlen(data), 100, &result);
+    CHECK(result.lines == 1 && strcmp(result.last_line, "$GNTXT,ok*00") == 0);
+    CHECK(splitter.overflows == 1);
+    nmea_splitter_reset(&splitter);
+
+    // the same, all in one read
+    memset(&result, 0, sizeof(result));
+    feed(&splitter, data, strlen(data), sizeof(data), &result);
+    CHECK(result.lines == 1 && splitter.overflows == 2);
+    nmea_splitter_deinit(&splitter);
+}
+
+static void test_ubx()
+{
+    nmea_splitter_t splitter;
+    result_t result = {0};
+    uint8_t poll[8], bad[8];
+    char data[512];
+    size_t len = 0;
+
+    // a line, a UBX message, a UBX message with a bad checksum, a partial line cut by a UBX message, a line
+    // NAV-PVT, not MON-VER: class 0x0A is a newline in the bytes skipped after the bad checksum
+    ubx_gen_poll(UBX_CLS_NAV, UBX_ID_NAV_PVT, poll);
+    memcpy(bad, poll, sizeof(bad));
+    bad[7] ^= 0xFF;
+
+    len += sprintf(data + len, "$GNGGA,1*00\r\n");
+    memcpy(data + len, poll, sizeof(poll));
+    len += sizeof(poll);
+    memcpy(data + len, bad, sizeof(bad));
+    len += sizeof(bad);
+    len += sprintf(data + len, "$GNGST,cut");
+    memcpy(data + len, poll, sizeof(poll));
+    len += sizeof(poll);
+    len += sprintf(data + len, "$GNRMC,2*00\r\n");
+
+    for (size_t block = 1; block <= len; block += 3)
+    {
+        memset(&result, 0, sizeof(result));
+        CHECK(nmea_splitter_init(&splitter, SPLITTER_LEN) == ESP_OK);
+        feed(&splitter, data, len, block, &result);
+        CHECK(result.lines == 2 && strcmp(result.last_line, "$GNRMC,2*00") == 0);
+        CHECK(result.ubx == 2 && result.last_ubx_len == sizeof(poll));
+        CHECK(splitter.ubx_errors == 1);
+        CHECK(splitter.overflows == 1);
+        nmea_splitter_deinit(&splitter);
+    }
+}
+
+// RXM-RAWX with all 255 measurements between two lines, the longest message the receiver sends
+static void test_rawx()
+{
+    nmea_splitter_t splitter;
+    static char data[64 + UBX_MSG_LEN_MAX];
+    size_t len = 0;
+
+    len += sprintf(data, "$GNGGA,1*00\r\n");
+    uint8_t* msg = (uint8_t*)data + len;
+    uint8_t ck_a = 0, ck_b = 0;
+    memset(msg, 0, UBX_MSG_LEN_MAX);
+    msg[0] = 0xB5;
+    msg[1] = 0x62;
+    msg[2] = UBX_CLS_RXM;
+    msg[3] = UBX_ID_RXM_RAWX;
+    msg[4] = UBX_PAYLOAD_LEN_MAX & 0xFF;
+    msg[5] = UBX_PAYLOAD_LEN_MAX >> 8;
+    msg[UBX_HEADER_LEN + 11] = 255;
+    for (size_t i = 2; i < UBX_HEADER_LEN + UBX_PAYLOAD_LEN_MAX; i++)
+    {
+        ck_a += msg[i];
+        ck_b += ck_a;
+    }
+    msg[UBX_HEADER_LEN + UBX_PAYLOAD_LEN_MAX] = ck_a;
+    msg[UBX_HEADER_LEN + UBX_PAYLOAD_LEN_MAX + 1] = ck_b;
+    len += UBX_MSG_LEN_MAX;
+    len += sprintf(data + len, "$GNRMC,2*00\r\n");
+
+    // one read, then reads of the 128-byte RX FIFO
+    static const size_t BLOCKS[] = {sizeof(data), 128, 1000};
+    for (size_t i = 0; i < sizeof(BLOCKS) / sizeof(BLOCKS[0]); i++)
+    {
+        result_t result = {0};
+        CHECK(nmea_splitter_init(&splitter, SPLITTER_LEN) == ESP_OK);
+        feed(&splitter, data, len, BLOCKS[i], &result);
+        CHECK(result.lines == 2 && strcmp(result.last_line, "$GNRMC,2*00") == 0);
+        CHECK(result.ubx == 1 && result.last_ubx_len == 8 + 16 + 32 * 255);
+        CHECK(splitter.ubx_errors == 0 && splitter.overflows == 0);
+        nmea_splitter_deinit(&splitter);
+    }
+
+    // a buffer that cannot hold it is refused
+    CHECK(nmea_splitter_init(&splitter, UBX_MSG_LEN_MAX - 1) == ESP_ERR_INVALID_SIZE);
+}
+
+// a 10 Hz receiver with the full NMEA set: GGA, GST, RMC, GSA x4, GSV x12, VTG per epoch
+static void bench_splitter()
+{
+    static const char* LINES[] = {
+        "$GNGGA,104548.00,2057.60024,N,10546.10688,E,4,12,0.62,12.3,M,-24.1,M,1.0,0000*5B",
+        "$GNGST,104548.00,12,0.012,0.008,42.1,0.010,0.009,0.020*7D",
+        "$GNRMC,104548.00,A,2057.60024,N,10546.10688,E,0.012,,161026,,,R,V*13",
+        "$GNGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.10,0.62,0.91,1*0C",
+        "$GPGSV,4,1,14,05,45,310,44,13,28,180,40,15,62,045,46,18,33,250,42,1*60",
+        "$GNVTG,,T,,M,0.012,N,0.022,K,R*3B",
+    };
+    static const int REPEAT[] = {1, 1, 1, 4, 12, 1};
+    const int EPOCHS = 36000;  // an hour at 10 Hz
+
+    char* data = malloc(EPOCHS * 2048);
+    size_t len = 0;
+    int lines = 0;
+    for (int e = 0; e < EPOCHS; e++)
+    {
+        for (size_t i = 0; i < sizeof(LINES) / sizeof(LINES[0]); i++)
+        {
+            for (int r = 0; r < REPEAT[i]; r++, lines++)
+            {
+                len += sprintf(data + len, "%s\r\n", LINES[i]);
+            }
+        }
+    }
+
+    nmea_splitter_t splitter;
+    result_t result = {0};
+    nmea_splitter_init(&splitter, SPLITTER_LEN);
+
+    // reads of the size uart_status_task gets at 38400 baud with a 10 ms pattern timeout
+    double start = test_cpu_s();
+    feed(&splitter, data, len, 512, &result);
+    double ms = (test_cpu_s() - start) * 1e3;
+
+    CHECK(result.lines == lines);
+    printf("nmea splitter: %d lines, %.0f lines/CPU-ms, %.1f MB/s\n", lines, lines / ms, len / ms / 1e3);
+    nmea_splitter_deinit(&splitter);
+    free(data);
+}
+
+int main(int argc, char* argv[])
+{
+    test_lines();
+    test_overlong();
+    test_ubx();
+    test_rawx();
+
+    if (TEST_BENCH(argc, argv))
+    {
+        bench_splitter();
+    }
+
+    return TEST_RESULT();
+}
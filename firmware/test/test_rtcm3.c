@@ -0,0 +1,288 @@
+#include <stdlib.h>
+
+#include "rtcm3.h"
+#include "test.h"
+#include "ublox.h"
+#include "util.h"
+
+// station 2003 reference position, the example frame of message 1005 in RTCM 10403
+static const uint8_t FRAME_1005[] = {0xD3, 0x00, 0x13, 0x3E, 0xD7, 0xD3, 0x02, 0x02, 0x98, 0x0E, 0xDE, 0xEF, 0x34,
+                                     0xB4, 0xBD, 0x62, 0xAC, 0x09, 0x41, 0x98, 0x6F, 0x33, 0x36, 0x0B, 0x98};
+
+// a valid frame of any type and length, the payload is filled from seed
+static size_t make_frame(uint8_t* frame, uint16_t type, size_t payload_len, uint32_t seed)
+{
+    frame[0] = RTCM3_PREAMBLE;
+    frame[1] = payload_len >> 8;
+    frame[2] = payload_len & 0xFF;
+    for (size_t i = 0; i < payload_len; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        frame[RTCM3_HEADER_LEN + i] = seed >> 16;
+    }
+    frame[3] = type >> 4;
+    frame[4] = (type << 4) | (frame[4] & 0x0F);
+
+    uint32_t crc = crc24q(frame, RTCM3_HEADER_LEN + payload_len);
+    frame[RTCM3_HEADER_LEN + payload_len] = crc >> 16;
+    frame[RTCM3_HEADER_LEN + payload_len + 1] = crc >> 8;
+    frame[RTCM3_HEADER_LEN + payload_len + 2] = crc;
+    return RTCM3_HEADER_LEN + payload_len + RTCM3_CRC_LEN;
+}
+
+// feed bytes to the framer in blocks of at most block, collect the frames that come out
+static int feed(rtcm3_framer_t* framer, const uint8_t* data, size_t len, size_t block, const uint8_t** frames, size_t* lens, int max)
+{
+    static uint8_t copies[8][RTCM3_FRAME_LEN_MAX];
+    const uint8_t* frame;
+    size_t frame_len, space, n;
+    int count = 0;
+
+    while (len > 0)
+    {
+        uint8_t* dst = rtcm3_framer_space(framer, &space);
+        n = MIN(MIN(len, block), space);
+        memcpy(dst, data, n);
+        rtcm3_framer_commit(framer, n);
+        data += n;
+        len -= n;
+
+        while (rtcm3_framer_next(framer, &frame, &frame_len))
+        {
+            if (count < max)
+            {
+                // a frame is only valid until the next space call
+                memcpy(copies[count % 8], frame, frame_len);
+                frames[count] = copies[count % 8];
+                lens[count] = frame_len;
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+static int crc_error_calls = 0;
+
+static void on_crc_error(const uint8_t* frame, size_t len)
+{
+    crc_error_calls++;
+}
+
+static void test_reference_frame()
+{
+    rtcm3_framer_t framer;
+    const uint8_t* frames[8];
+    size_t lens[8];
+
+    CHECK(crc24q(FRAME_1005, sizeof(FRAME_1005) - RTCM3_CRC_LEN) == 0x360B98);
+    CHECK(rtcm3_msg_type(FRAME_1005) == 1005);
+    CHECK(rtcm3_getbitu(FRAME_1005, 24 + 12, 12) == 2003);
+    CHECK(!rtcm3_is_msm(1005));
+
+    CHECK(rtcm3_framer_init(&framer, RTCM3_FRAME_LEN_MAX + 1) == ESP_OK);
+    CHECK(feed(&framer, FRAME_1005, sizeof(FRAME_1005), 4096, frames, lens, 8) == 1);
+    CHECK(lens[0] == sizeof(FRAME_1005) && memcmp(frames[0], FRAME_1005, sizeof(FRAME_1005)) == 0);
+    CHECK(framer.frames == 1 && framer.crc_errors == 0 && framer.skipped == 0);
+    rtcm3_framer_deinit(&framer);
+}
+
+static void test_split_reads()
+{
+    rtcm3_framer_t framer;
+    const uint8_t* frames[8];
+    size_t lens[8];
+    uint8_t stream[3 * RTCM3_FRAME_LEN_MAX];
+    size_t len = 0;
+
+    len += make_frame(stream + len, 1077, 400, 1);
+    len += make_frame(stream + len, 1087, RTCM3_PAYLOAD_LEN_MAX, 2);
+    len += make_frame(stream + len, 1230, 6, 3);
+
+    // one byte per read, as a slow UART would deliver them
+    CHECK(rtcm3_framer_init(&framer, RTCM3_FRAME_LEN_MAX + 1) == ESP_OK);
+    CHECK(feed(&framer, stream, len, 1, frames, lens, 8) == 3);
+    CHECK(rtcm3_msg_type(frames[0]) == 1077 && lens[0] == 406);
+    CHECK(rtcm3_msg_type(frames[1]) == 1087 && lens[1] == RTCM3_FRAME_LEN_MAX);
+    CHECK(rtcm3_msg_type(frames[2]) == 1230 && lens[2] == 12);
+    CHECK(framer.skipped == 0);
+    rtcm3_framer_deinit(&framer);
+
+    // reads that end in every possible place of the frames
+    for (size_t block = 2; block < 64; block += 7)
+    {
+        CHECK(rtcm3_framer_init(&framer, 2 * RTCM3_FRAME_LEN_MAX) == ESP_OK);
+        CHECK(feed(&framer, stream, len, block, frames, lens, 8) == 3);
+        rtcm3_framer_deinit(&framer);
+    }
+}
+
+static void test_resync()
+{
+    rtcm3_framer_t framer;
+    const uint8_t* frames[8];
+    size_t lens[8];
+    uint8_t stream[1024];
+    size_t len = 0;
+
+    // garbage with a false preamble, a false preamble with a valid looking header, then a frame
+    const uint8_t garbage[] = {0x00, 0x55, 0xD3, 0xFF, 0x12, 0xD3, 0x00, 0x04, 0x01, 0x02};
+    memcpy(stream + len, garbage, sizeof(garbage));
+    len += sizeof(garbage);
+    memcpy(stream + len, FRAME_1005, sizeof(FRAME_1005));
+    len += sizeof(FRAME_1005);
+
+    // the same frame with a flipped bit, then good ones; its own 0xD3 at offset 5 looks like a 514 byte frame
+    memcpy(stream + len, FRAME_1005, sizeof(FRAME_1005));
+    stream[len + 10] ^= 0x20;
+    len += sizeof(FRAME_1005);
+    for (int i = 0; i < 3; i++)
+    {
+        len += make_frame(stream + len, 1097, 200, 4 + i);
+    }
+
+    crc_error_calls = 0;
+    CHECK(rtcm3_framer_init(&framer, RTCM3_FRAME_LEN_MAX + 1) == ESP_OK);
+    framer.crc_error = on_crc_error;
+    CHECK(feed(&framer, stream, len, 64, frames, lens, 8) == 4);
+    CHECK(rtcm3_msg_type(frames[0]) == 1005 && lens[0] == sizeof(FRAME_1005));
+    CHECK(rtcm3_msg_type(frames[1]) == 1097 && lens[1] == 206);
+    CHECK(rtcm3_msg_type(frames[3]) == 1097 && lens[3] == 206);
+    CHECK(framer.frames == 4);
+    CHECK(framer.crc_errors >= 1 && crc_error_calls == (int)framer.crc_errors);
+
+    // every byte that is not part of a delivered frame is skipped
+    CHECK(framer.skipped == sizeof(garbage) + sizeof(FRAME_1005));
+    rtcm3_framer_deinit(&framer);
+}
+
+static void test_filter()
+{
+    rtcm3_filter_t filter;
+
+    rtcm3_filter_fill(&filter, false);
+    rtcm3_filter_set(&filter, 1005, true);
+    CHECK(rtcm3_filter_match(&filter, FRAME_1005));
+    rtcm3_filter_set(&filter, 1005, false);
+    CHECK(!rtcm3_filter_match(&filter, FRAME_1005));
+
+    CHECK(rtcm3_type_slot(1000) == 0 && rtcm3_slot_type(0) == 1000);
+    CHECK(rtcm3_slot_type(rtcm3_type_slot(4072)) == 4072);
+    CHECK(rtcm3_type_slot(999) == RTCM3_TYPE_SLOTS - 1 && rtcm3_type_slot(5000) == RTCM3_TYPE_SLOTS - 1);
+    CHECK(rtcm3_is_msm(1077) && rtcm3_is_msm(1137) && !rtcm3_is_msm(1070) && !rtcm3_is_msm(1078));
+}
+
+static bool allows(const rtcm3_filter_t* filter, uint16_t type)
+{
+    size_t slot = rtcm3_type_slot(type);
+    return filter->bits[slot / 32] & (1u << (slot % 32));
+}
+
+static void test_filter_gnss()
+{
+    rtcm3_filter_t filter, query;
+
+    CHECK(rtcm3_gnss_find("GAL", 3) < RTCM3_GNSS_COUNT && rtcm3_gnss_find("SBAS", 4) < RTCM3_GNSS_COUNT);
+    CHECK(rtcm3_gnss_find("GA", 2) == RTCM3_GNSS_COUNT && rtcm3_gnss_find("GALX", 4) == RTCM3_GNSS_COUNT);
+    CHECK(rtcm3_gnss_find("GAL-GPS", 7) == RTCM3_GNSS_COUNT && rtcm3_gnss_find("", 0) == RTCM3_GNSS_COUNT);
+
+    // "/BASE-GPS-GAL": MSMs, ephemerides and biases of the listed GNSS only, other types pass
+    const char* path = "-GPS-GAL";
+    rtcm3_filter_fill(&filter, true);
+    CHECK(rtcm3_filter_gnss(&filter, path, strlen(path), "-"));
+    CHECK(allows(&filter, 1074) && allows(&filter, 1077) && allows(&filter, 1019));
+    CHECK(allows(&filter, 1094) && allows(&filter, 1045) && allows(&filter, 1046));
+    CHECK(!allows(&filter, 1084) && !allows(&filter, 1020) && !allows(&filter, 1230) && !allows(&filter, 1127) && !allows(&filter, 1042));
+    CHECK(allows(&filter, 1005) && allows(&filter, 1033));
+
+    // names that only contain a GNSS name, or unknown ones, list nothing
+    path = "-GPSX-XGAL-";
+    rtcm3_filter_fill(&filter, true);
+    CHECK(!rtcm3_filter_gnss(&filter, path, strlen(path), "-"));
+    CHECK(!allows(&filter, 1077) && !allows(&filter, 1097) && allows(&filter, 1005));
+
+    // "/BASE-GAL?gnss=GPS": the query is not part of the path list, and the intersection of both is empty
+    const char* uri = "-GAL?gnss=GPS";
+    rtcm3_filter_fill(&filter, true);
+    CHECK(rtcm3_filter_gnss(&filter, uri, strcspn(uri, "?"), "-"));
+    CHECK(allows(&filter, 1097) && !allows(&filter, 1077));
+    rtcm3_filter_fill(&query, true);
+    CHECK(rtcm3_filter_gnss(&query, "GPS", 3, "+, "));
+    rtcm3_filter_intersect(&filter, &query);
+    CHECK(!allows(&filter, 1097) && !allows(&filter, 1077) && allows(&filter, 1005));
+
+    // "/BASE-GAL-GPS?gnss=GPS+GLO" narrows to GPS
+    uri = "-GAL-GPS?gnss=GPS+GLO";
+    rtcm3_filter_fill(&filter, true);
+    CHECK(rtcm3_filter_gnss(&filter, uri, strcspn(uri, "?"), "-"));
+    rtcm3_filter_fill(&query, true);
+    CHECK(rtcm3_filter_gnss(&query, "GPS+GLO", 7, "+, "));
+    rtcm3_filter_intersect(&filter, &query);
+    CHECK(allows(&filter, 1077) && !allows(&filter, 1097) && !allows(&filter, 1087));
+}
+
+// one epoch of a four constellation MSM7 base at the sizes seen on a ZED-F9P, fed in UART sized reads
+static void bench_framer()
+{
+    static const struct
+    {
+        uint16_t type;
+        size_t len;
+    } EPOCH[] = {{1005, 19}, {1077, 480}, {1087, 380}, {1097, 420}, {1127, 520}, {1230, 6}};
+    const size_t EPOCHS = 2000;
+
+    uint8_t* stream = malloc(EPOCHS * 6 * 530);
+    size_t len = 0;
+    for (size_t e = 0; e < EPOCHS; e++)
+    {
+        for (size_t i = 0; i < 6; i++)
+        {
+            len += make_frame(stream + len, EPOCH[i].type, EPOCH[i].len, e * 6 + i);
+        }
+    }
+
+    rtcm3_framer_t framer;
+    const uint8_t* frame;
+    size_t frame_len, space, n;
+    uint32_t frames = 0;
+    const int ROUNDS = 20;
+
+    rtcm3_framer_init(&framer, 2 * 4096);
+    double start = test_cpu_s();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        for (size_t pos = 0; pos < len; pos += n)
+        {
+            uint8_t* dst = rtcm3_framer_space(&framer, &space);
+            n = MIN(MIN(len - pos, 4096), space);
+            memcpy(dst, stream + pos, n);
+            rtcm3_framer_commit(&framer, n);
+            while (rtcm3_framer_next(&framer, &frame, &frame_len))
+            {
+                frames++;
+            }
+        }
+    }
+    double s = test_cpu_s() - start;
+
+    CHECK(frames == ROUNDS * EPOCHS * 6);
+    printf("rtcm3 framer: %u frames, %.0f frames/s, %.1f MB/s\n", frames, frames / s, ROUNDS * len / s / 1e6);
+    rtcm3_framer_deinit(&framer);
+    free(stream);
+}
+
+int main(int argc, char* argv[])
+{
+    test_reference_frame();
+    test_split_reads();
+    test_resync();
+    test_filter();
+    test_filter_gnss();
+
+    if (TEST_BENCH(argc, argv))
+    {
+        bench_framer();
+    }
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,291 @@
+#include <stdlib.h>
+
+#include "rtcm3.h"
+#include "rtcm3_msm.h"
+#include "test.h"
+#include "ublox.h"
+
+// per MSM number, from RTCM 10403.3 tables 3.5-78..81: satellite data, signal data before CNR, CNR, signal data after CNR
+static const struct
+{
+    int sat, pre, cnr, post;
+} FIELDS[8] = {
+    {0, 0, 0, 0},
+    {10, 15, 0, 0},    // MSM1: rough range, fine pseudorange
+    {10, 27, 0, 0},    // MSM2: fine phaserange, lock time, half-cycle
+    {10, 42, 0, 0},    // MSM3
+    {18, 42, 6, 0},    // MSM4: + extended rough range, CNR
+    {36, 42, 6, 15},   // MSM5: + extended info, rough and fine phaserange rate
+    {18, 55, 10, 0},   // MSM6: extended resolution MSM4
+    {36, 55, 10, 15},  // MSM7: extended resolution MSM5
+};
+
+static void setbitu(uint8_t* buff, int pos, int len, uint64_t data)
+{
+    for (int i = 0; i < len; i++, pos++)
+    {
+        uint8_t mask = 0x80 >> (pos % 8);
+        if ((data >> (len - 1 - i)) & 1)
+        {
+            buff[pos / 8] |= mask;
+        }
+        else
+        {
+            buff[pos / 8] &= ~mask;
+        }
+    }
+}
+
+// a bit-packed MSM frame; cells lists the present satellite x signal cells in mask order, cnr is the raw field of each
+static size_t make_msm(uint8_t* frame, uint16_t type, bool multiple, const uint8_t* sats, int num_sat, uint32_t sig_mask, const bool* cells,
+                       const uint16_t* cnr, uint32_t seed)
+{
+    int num_sig = __builtin_popcount(sig_mask);
+    int msm = type % 10;
+    int num_cell = 0;
+    int pos = 24;
+
+    memset(frame, 0, RTCM3_FRAME_LEN_MAX);
+    setbitu(frame, pos, 12, type);
+    pos += 12;
+    setbitu(frame, pos, 12, 2003);  // station
+    pos += 12;
+    setbitu(frame, pos, 30, 123456789);  // epoch time
+    pos += 30;
+    setbitu(frame, pos, 1, multiple);
+    pos += 1;
+    pos += 3 + 7 + 2 + 2 + 1 + 3;  // IODS, reserved, clock steering, external clock, smoothing
+
+    uint64_t sat_mask = 0;
+    for (int i = 0; i < num_sat; i++)
+    {
+        sat_mask |= 1ULL << (64 - sats[i]);
+    }
+    setbitu(frame, pos, 64, sat_mask);
+    pos += 64;
+    setbitu(frame, pos, 32, sig_mask);
+    pos += 32;
+    for (int i = 0; i < num_sat * num_sig; i++)
+    {
+        setbitu(frame, pos++, 1, cells[i]);
+        num_cell += cells[i];
+    }
+
+    // everything but CNR is noise, only its size matters
+    for (int i = 0; i < num_sat * FIELDS[msm].sat + num_cell * FIELDS[msm].pre; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        setbitu(frame, pos++, 1, seed >> 16);
+    }
+    for (int i = 0; i < num_cell; i++)
+    {
+        setbitu(frame, pos, FIELDS[msm].cnr, cnr[i]);
+        pos += FIELDS[msm].cnr;
+    }
+    for (int i = 0; i < num_cell * FIELDS[msm].post; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        setbitu(frame, pos++, 1, seed >> 16);
+    }
+
+    size_t payload_len = (pos - 24 + 7) / 8;
+    frame[0] = RTCM3_PREAMBLE;
+    frame[1] = payload_len >> 8;
+    frame[2] = payload_len & 0xFF;
+    uint32_t crc = crc24q(frame, RTCM3_HEADER_LEN + payload_len);
+    frame[RTCM3_HEADER_LEN + payload_len] = crc >> 16;
+    frame[RTCM3_HEADER_LEN + payload_len + 1] = crc >> 8;
+    frame[RTCM3_HEADER_LEN + payload_len + 2] = crc;
+    return RTCM3_HEADER_LEN + payload_len + RTCM3_CRC_LEN;
+}
+
+// every cell of num_sat satellites x num_sig signals present, CNR of cell i is base + i
+static size_t make_full_msm(uint8_t* frame, uint16_t type, bool multiple, int first_sat, int num_sat, uint32_t sig_mask, uint16_t base, uint32_t seed)
+{
+    // room for any masks, also the ones the decoder must reject
+    uint8_t sats[64];
+    bool cells[64 * 32];
+    uint16_t cnr[64 * 32];
+    int num_cell = num_sat * __builtin_popcount(sig_mask);
+
+    for (int i = 0; i < num_sat; i++)
+    {
+        sats[i] = first_sat + i;
+    }
+    for (int i = 0; i < num_cell; i++)
+    {
+        cells[i] = true;
+        cnr[i] = base + i;
+    }
+    return make_msm(frame, type, multiple, sats, num_sat, sig_mask, cells, cnr, seed);
+}
+
+static void test_msm7()
+{
+    static uint8_t frame[RTCM3_FRAME_LEN_MAX];
+    rtcm3_msm_decoder_t decoder;
+
+    // GPS 1, 5 and 32 on L1C and L2L, no L2L on satellite 5; CNR in 1/16 dBHz
+    const uint8_t sats[] = {1, 5, 32};
+    const uint32_t sig_mask = (1u << (32 - 2)) | (1u << (32 - 16));
+    const bool cells[] = {true, true, true, false, true, true};
+    const uint16_t cnr[] = {45 * 16 + 8, 40 * 16, 30 * 16 + 1, 0, 50 * 16};
+    size_t len = make_msm(frame, 1077, false, sats, 3, sig_mask, cells, cnr, 1);
+
+    rtcm3_msm_reset(&decoder);
+    CHECK(rtcm3_msg_type(frame) == 1077 && !rtcm3_msm_multiple(frame) && rtcm3_msm_epoch(frame) == 123456789);
+    CHECK(rtcm3_msm_decode(&decoder, frame, len));
+    CHECK(decoder.complete && decoder.errors == 0 && decoder.layout_changes == 1);
+    CHECK(decoder.sky.epochs == 1 && decoder.sky.num_sat == 3 && decoder.sky.num_signals == 5);
+    CHECK(decoder.sky.sats[0].gnss == 0 && decoder.sky.sats[0].id == 1 && decoder.sky.sats[0].signals == 2);
+    CHECK(decoder.sky.sats[0].cnr == 45 * 16 + 8);
+    CHECK(decoder.sky.sats[1].id == 5 && decoder.sky.sats[1].signals == 1 && decoder.sky.sats[1].cnr == 30 * 16 + 1);
+    CHECK(decoder.sky.sats[2].id == 32 && decoder.sky.sats[2].signals == 2 && decoder.sky.sats[2].cnr == 50 * 16);
+    // a zero CNR is a signal without one, not a 0 dBHz signal
+    CHECK(decoder.sky.cnr_avg == (45 * 16 + 8 + 40 * 16 + 30 * 16 + 1 + 50 * 16) / 4);
+
+    // the same masks next epoch reuse the layout
+    len = make_msm(frame, 1077, false, sats, 3, sig_mask, cells, cnr, 2);
+    CHECK(rtcm3_msm_decode(&decoder, frame, len));
+    CHECK(decoder.layout_changes == 1 && decoder.sky.epochs == 2 && decoder.sky.num_sat == 3 && decoder.sky.num_signals == 5);
+
+    // satellite 64 is the last bit of the mask
+    len = make_full_msm(frame, 1077, false, 64, 1, sig_mask, 100, 3);
+    CHECK(rtcm3_msm_decode(&decoder, frame, len));
+    CHECK(decoder.layout_changes == 2 && decoder.sky.num_sat == 1 && decoder.sky.sats[0].id == 64 && decoder.sky.sats[0].signals == 2);
+}
+
+static void test_epoch()
+{
+    static uint8_t frame[RTCM3_FRAME_LEN_MAX];
+    rtcm3_msm_decoder_t decoder;
+    size_t len;
+
+    // GPS, Galileo and BeiDou of one epoch, the multiple message bit is cleared on the last
+    rtcm3_msm_reset(&decoder);
+    len = make_full_msm(frame, 1077, true, 3, 8, 0x41000000, 40 * 16, 1);
+    CHECK(!rtcm3_msm_decode(&decoder, frame, len) && !decoder.complete);
+    len = make_full_msm(frame, 1097, true, 10, 6, 0x40020000, 42 * 16, 2);
+    CHECK(!rtcm3_msm_decode(&decoder, frame, len) && !decoder.complete);
+    len = make_full_msm(frame, 1127, false, 20, 10, 0x48000000, 44 * 16, 3);
+    CHECK(rtcm3_msm_decode(&decoder, frame, len) && decoder.complete);
+
+    CHECK(decoder.sky.epochs == 1 && decoder.sky.num_sat == 24 && decoder.sky.num_signals == 48);
+    CHECK(decoder.sky.sats[0].gnss == 0 && decoder.sky.sats[0].id == 3);
+    CHECK(decoder.sky.sats[8].gnss == 2 && decoder.sky.sats[8].id == 10);
+    CHECK(decoder.sky.sats[23].gnss == 5 && decoder.sky.sats[23].id == 29);
+    CHECK(decoder.sky.sats[23].cnr == 44 * 16 + 19);  // the stronger of its two signals
+    CHECK(decoder.layout_changes == 3);
+
+    // the next frame starts a new epoch
+    len = make_full_msm(frame, 1087, false, 1, 2, 0x41000000, 35 * 16, 4);
+    CHECK(rtcm3_msm_decode(&decoder, frame, len));
+    CHECK(decoder.sky.epochs == 2 && decoder.sky.num_sat == 2 && decoder.sky.sats[0].gnss == 1);
+    CHECK(decoder.sky.cnr_avg == 35 * 16 + 1);  // (0 + 1 + 2 + 3) / 4, rounded down
+
+    // non MSM frames are not decoded
+    const uint8_t FRAME_1005[] = {0xD3, 0x00, 0x13, 0x3E, 0xD7, 0xD3, 0x02, 0x02, 0x98, 0x0E, 0xDE, 0xEF, 0x34,
+                                  0xB4, 0xBD, 0x62, 0xAC, 0x09, 0x41, 0x98, 0x6F, 0x33, 0x36, 0x0B, 0x98};
+    CHECK(!rtcm3_msm_decode(&decoder, FRAME_1005, sizeof(FRAME_1005)) && decoder.errors == 0);
+}
+
+static void test_msm_numbers()
+{
+    static uint8_t frame[RTCM3_FRAME_LEN_MAX];
+    rtcm3_msm_decoder_t decoder;
+    size_t len;
+
+    // every MSM number, so each row of the field sizes puts CNR where the spec does
+    for (int msm = 1; msm <= 7; msm++)
+    {
+        uint16_t base = FIELDS[msm].cnr == 6 ? 30 : FIELDS[msm].cnr == 10 ? 30 * 16 : 0;
+        rtcm3_msm_reset(&decoder);
+        len = make_full_msm(frame, 1070 + msm, false, 1, 7, 0x41000000, base, msm);
+        CHECK(rtcm3_msm_decode(&decoder, frame, len));
+        CHECK(decoder.errors == 0 && decoder.sky.num_sat == 7 && decoder.sky.num_signals == 14);
+
+        // MSM4/5 carry whole dBHz, scaled to 1/16
+        uint16_t last = FIELDS[msm].cnr == 6 ? (base + 13) << 4 : FIELDS[msm].cnr == 10 ? base + 13 : 0;
+        CHECK(decoder.sky.sats[6].cnr == last);
+
+        // a frame that ends with the CNR block is enough, one bit less is not
+        int cnr_end = 24 + 73 + 64 + 32 + 14 + 7 * FIELDS[msm].sat + 14 * (FIELDS[msm].pre + FIELDS[msm].cnr);
+        CHECK(rtcm3_msm_decode(&decoder, frame, (cnr_end + 7) / 8 + RTCM3_CRC_LEN));
+        CHECK(!rtcm3_msm_decode(&decoder, frame, (cnr_end - 1) / 8 + RTCM3_CRC_LEN) && decoder.errors == 1);
+    }
+}
+
+static void test_errors()
+{
+    static uint8_t frame[RTCM3_FRAME_LEN_MAX];
+    rtcm3_msm_decoder_t decoder;
+    size_t len;
+
+    // 13 satellites x 5 signals do not fit RTCM3_MSM_CELL_MAX
+    rtcm3_msm_reset(&decoder);
+    len = make_full_msm(frame, 1077, false, 1, 13, 0x7C000000, 0, 1);
+    CHECK(!rtcm3_msm_decode(&decoder, frame, len) && decoder.errors == 1);
+
+    // 16 x 4 is the most that fits
+    len = make_full_msm(frame, 1077, false, 1, 16, 0x78000000, 0, 1);
+    CHECK(rtcm3_msm_decode(&decoder, frame, len) && decoder.sky.num_signals == 64);
+
+    // cut inside the satellite data: the masks are read, the cells are not
+    uint32_t changes = decoder.layout_changes;
+    len = make_full_msm(frame, 1077, false, 1, 10, 0x41000000, 40 * 16, 2);
+    CHECK(!rtcm3_msm_decode(&decoder, frame, 40 + RTCM3_CRC_LEN) && decoder.errors == 2 && decoder.layout_changes == changes + 1);
+    CHECK(rtcm3_msm_decode(&decoder, frame, len) && decoder.layout_changes == changes + 1);
+
+    // cut inside the cell mask: the layout is dropped, the next good frame rebuilds it
+    CHECK(!rtcm3_msm_decode(&decoder, frame, 26 + RTCM3_CRC_LEN) && decoder.errors == 3);
+    CHECK(rtcm3_msm_decode(&decoder, frame, len) && decoder.layout_changes == changes + 2);
+}
+
+// a 10 Hz four constellation MSM7 base: every epoch must be decoded well inside its 100 ms
+static void bench_decode()
+{
+    const uint16_t TYPES[] = {1077, 1087, 1097, 1127};
+    const int EPOCHS = 200000;
+    static uint8_t frames[4][RTCM3_FRAME_LEN_MAX];
+    size_t lens[4];
+    rtcm3_msm_decoder_t decoder;
+    uint32_t epochs = 0;
+
+    // 12 satellites with 2 signals each per constellation, a clear sky for a ZED-F9P
+    for (int i = 0; i < 4; i++)
+    {
+        lens[i] = make_full_msm(frames[i], TYPES[i], i < 3, 1, 12, 0x41000000, 40 * 16, i);
+    }
+
+    rtcm3_msm_reset(&decoder);
+    double start = test_cpu_s();
+    for (int e = 0; e < EPOCHS; e++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            epochs += rtcm3_msm_decode(&decoder, frames[i], lens[i]);
+        }
+    }
+    double s = test_cpu_s() - start;
+
+    CHECK(epochs == EPOCHS && decoder.sky.num_sat == 48 && decoder.sky.num_signals == 96);
+    printf("rtcm3 msm decode: %u epochs of 4 x MSM7 (48 sats, 96 signals), %.2f us/epoch, %.4f%% of a 10 Hz epoch\n",
+           epochs,
+           s / epochs * 1e6,
+           s / epochs / 0.1 * 100);
+}
+
+int main(int argc, char* argv[])
+{
+    test_msm7();
+    test_epoch();
+    test_msm_numbers();
+    test_errors();
+
+    if (TEST_BENCH(argc, argv))
+    {
+        bench_decode();
+    }
+
+    return TEST_RESULT();
+}
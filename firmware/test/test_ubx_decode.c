@@ -0,0 +1,330 @@
+#include <stdlib.h>
+
+#include "nmea.h"
+#include "test.h"
+#include "ublox.h"
+
+// little-endian field writers, kept apart from the ones in ublox.c
+static void put(uint8_t* p, uint64_t value, int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        p[i] = value >> (8 * i);
+    }
+}
+
+// frame a payload with sync, class, id, length and Fletcher checksum
+static size_t make_ubx(uint8_t* msg, uint8_t cls, uint8_t id, const uint8_t* payload, size_t len)
+{
+    uint8_t ck_a = 0, ck_b = 0;
+
+    msg[0] = 0xB5;
+    msg[1] = 0x62;
+    msg[2] = cls;
+    msg[3] = id;
+    put(msg + 4, len, 2);
+    memcpy(msg + UBX_HEADER_LEN, payload, len);
+    for (size_t i = 2; i < UBX_HEADER_LEN + len; i++)
+    {
+        ck_a += msg[i];
+        ck_b += ck_a;
+    }
+    msg[UBX_HEADER_LEN + len] = ck_a;
+    msg[UBX_HEADER_LEN + len + 1] = ck_b;
+    return UBX_HEADER_LEN + len + UBX_CHECKSUM_LEN;
+}
+
+// append "*hh" and "\0" to an NMEA body that starts with '$'
+static size_t make_nmea(char* line, const char* body)
+{
+    uint8_t sum = 0;
+    for (const char* c = body + 1; *c != '\0'; c++)
+    {
+        sum ^= *c;
+    }
+    return sprintf(line, "%s*%02X", body, sum);
+}
+
+static size_t nav_pvt(uint8_t* msg)
+{
+    uint8_t p[92] = {0};
+
+    put(p, 388800000, 4);  // iTOW
+    put(p + 4, 2026, 2);
+    p[6] = 10;
+    p[7] = 16;
+    p[8] = 10;
+    p[9] = 48;
+    p[10] = 0;
+    put(p + 16, (uint32_t)-250000, 4);  // nano
+    p[20] = 3;                          // 3D
+    p[21] = 0x01 | 0x02 | (2 << 6);     // gnssFixOK, diffSoln, fixed
+    p[23] = 28;
+    put(p + 24, 1057684480, 4);        // lon
+    put(p + 28, 209600040, 4);         // lat
+    put(p + 32, (uint32_t)-11800, 4);  // height
+    put(p + 36, 12300, 4);             // hMSL
+    put(p + 40, 14, 4);                // hAcc
+    put(p + 44, 21, 4);                // vAcc
+    put(p + 76, 112, 2);               // pDOP
+    return make_ubx(msg, UBX_CLS_NAV, UBX_ID_NAV_PVT, p, sizeof(p));
+}
+
+static size_t nav_dop(uint8_t* msg)
+{
+    uint8_t p[18] = {0};
+
+    put(p, 388800000, 4);
+    put(p + 4, 131, 2);
+    put(p + 6, 112, 2);
+    put(p + 8, 68, 2);
+    put(p + 10, 91, 2);
+    put(p + 12, 62, 2);
+    put(p + 14, 45, 2);
+    put(p + 16, 43, 2);
+    return make_ubx(msg, UBX_CLS_NAV, UBX_ID_NAV_DOP, p, sizeof(p));
+}
+
+static size_t nav_hpposllh(uint8_t* msg)
+{
+    uint8_t p[36] = {0};
+
+    put(p + 4, 388800000, 4);
+    put(p + 8, 1057684480, 4);
+    put(p + 12, 209600040, 4);
+    put(p + 16, (uint32_t)-11800, 4);
+    put(p + 20, 12300, 4);
+    p[24] = (uint8_t)-7;  // lonHp
+    p[25] = 33;           // latHp
+    p[26] = 4;            // heightHp
+    p[27] = (uint8_t)-5;  // hMSLHp
+    put(p + 28, 141, 4);
+    put(p + 32, 213, 4);
+    return make_ubx(msg, UBX_CLS_NAV, UBX_ID_NAV_HPPOSLLH, p, sizeof(p));
+}
+
+static size_t nav_svin(uint8_t* msg)
+{
+    uint8_t p[40] = {0};
+
+    put(p + 4, 388800000, 4);
+    put(p + 8, 300, 4);
+    put(p + 12, (uint32_t)-162638712, 4);  // meanX, cm
+    put(p + 16, 576016385, 4);
+    put(p + 20, 226918810, 4);
+    p[24] = 12;
+    p[25] = (uint8_t)-3;
+    p[26] = 0;
+    put(p + 28, 4870, 4);
+    put(p + 32, 300, 4);
+    p[36] = 1;
+    p[37] = 0;
+    return make_ubx(msg, UBX_CLS_NAV, UBX_ID_NAV_SVIN, p, sizeof(p));
+}
+
+static size_t nav_sat(uint8_t* msg, int num_svs)
+{
+    uint8_t p[8 + 12 * 64] = {0};
+
+    put(p, 388800000, 4);
+    p[5] = num_svs;
+    for (int i = 0; i < num_svs; i++)
+    {
+        uint8_t* sv = p + 8 + 12 * i;
+        sv[2] = 30 + i;                    // cno
+        put(sv + 8, i % 2 ? 0x08 : 0, 4);  // svUsed on every other one
+    }
+    return make_ubx(msg, UBX_CLS_NAV, UBX_ID_NAV_SAT, p, 8 + 12 * num_svs);
+}
+
+static size_t rxm_rawx(uint8_t* msg, int num_meas)
+{
+    static uint8_t p[16 + 32 * 255];
+    double tow = 388800.125;
+
+    memset(p, 0, sizeof(p));
+    memcpy(p, &tow, 8);
+    put(p + 8, 2440, 2);
+    p[10] = 18;
+    p[11] = num_meas;
+    p[12] = 0x01;
+    return make_ubx(msg, UBX_CLS_RXM, UBX_ID_RXM_RAWX, p, 16 + 32 * num_meas);
+}
+
+static void test_nav()
+{
+    static uint8_t msg[UBX_HEADER_LEN + 16 + 32 * 255 + UBX_CHECKSUM_LEN];
+    size_t len;
+
+    ubx_nav_pvt_t pvt;
+    len = nav_pvt(msg);
+    CHECK(ubx_check_msg(msg, len));
+    CHECK(ubx_decode_nav_pvt(msg, len, &pvt));
+    CHECK(pvt.itow == 388800000 && pvt.year == 2026 && pvt.month == 10 && pvt.day == 16);
+    CHECK(pvt.hour == 10 && pvt.min == 48 && pvt.sec == 0 && pvt.nano == -250000);
+    CHECK(pvt.fix_type == 3 && pvt.flags == 0x83 && pvt.num_sv == 28);
+    CHECK(pvt.lon == 1057684480 && pvt.lat == 209600040 && pvt.height == -11800 && pvt.hmsl == 12300);
+    CHECK(pvt.hacc == 14 && pvt.vacc == 21 && pvt.pdop == 112);
+    CHECK(!ubx_decode_nav_pvt(msg, len - 1, &pvt));
+
+    ubx_nav_dop_t dop;
+    len = nav_dop(msg);
+    CHECK(ubx_decode_nav_dop(msg, len, &dop));
+    CHECK(dop.gdop == 131 && dop.pdop == 112 && dop.tdop == 68 && dop.vdop == 91 && dop.hdop == 62 && dop.ndop == 45 && dop.edop == 43);
+
+    ubx_nav_hpposllh_t pos;
+    len = nav_hpposllh(msg);
+    CHECK(ubx_decode_nav_hpposllh(msg, len, &pos));
+    CHECK(!pos.invalid && pos.itow == 388800000 && pos.lon == 1057684480 && pos.lat == 209600040);
+    CHECK(pos.height == -11800 && pos.hmsl == 12300 && pos.lon_hp == -7 && pos.lat_hp == 33 && pos.height_hp == 4 && pos.hmsl_hp == -5);
+    CHECK(pos.hacc == 141 && pos.vacc == 213);
+
+    ubx_nav_svin_t svin;
+    len = nav_svin(msg);
+    CHECK(ubx_decode_nav_svin(msg, len, &svin));
+    CHECK(svin.dur == 300 && svin.mean_x == -162638712 && svin.mean_y == 576016385 && svin.mean_z == 226918810);
+    CHECK(svin.mean_x_hp == 12 && svin.mean_y_hp == -3 && svin.mean_acc == 4870 && svin.obs == 300 && svin.valid && !svin.active);
+
+    ubx_nav_sat_t sat;
+    len = nav_sat(msg, 40);
+    CHECK(ubx_decode_nav_sat(msg, len, &sat));
+    CHECK(sat.num_svs == 40 && sat.num_used == 20 && sat.cno_max == 69);
+    CHECK(sat.cno_avg == 50);  // 31, 33, .. 69
+    CHECK(!ubx_decode_nav_sat(msg, len - 12, &sat));
+}
+
+static void test_rawx()
+{
+    static uint8_t msg[UBX_HEADER_LEN + 16 + 32 * 255 + UBX_CHECKSUM_LEN];
+    ubx_rxm_rawx_t rawx;
+
+    // the longest epoch, all 255 measurements
+    size_t len = rxm_rawx(msg, 255);
+    CHECK(len == 8 + 16 + 32 * 255);
+    CHECK(ubx_check_msg(msg, len));
+    CHECK(ubx_decode_rxm_rawx(msg, len, &rawx));
+    CHECK(rawx.rcv_tow == 388800.125 && rawx.week == 2440 && rawx.leap_s == 18 && rawx.num_meas == 255 && rawx.rec_stat == 0x01);
+    CHECK(!ubx_decode_rxm_rawx(msg, len - 32, &rawx));
+}
+
+static void test_find()
+{
+    uint8_t buff[256];
+    size_t len = 0;
+
+    // garbage, a NAV-DOP with a bad checksum, then a good one
+    memset(buff, 0xB5, 5);
+    len += 5;
+    len += nav_dop(buff + len);
+    buff[len - 1] ^= 0x01;
+    size_t good = len;
+    len += nav_dop(buff + len);
+
+    CHECK(ubx_find_msg(buff, len, UBX_CLS_NAV, UBX_ID_NAV_DOP) == (int)good);
+    CHECK(ubx_find_msg(buff, len, UBX_CLS_NAV, UBX_ID_NAV_PVT) == -1);
+    CHECK(!ubx_check_msg(buff + 5, good - 5));
+    CHECK(ubx_check_msg(buff + good, len - good));
+}
+
+// one epoch of the UBX status set against the NMEA set it replaced
+static void bench_decode()
+{
+    static uint8_t epoch[4096];
+    size_t offset[6], len = 0;
+    const int EPOCHS = 200000;
+
+    offset[0] = len;
+    len += nav_pvt(epoch + len);
+    offset[1] = len;
+    len += nav_dop(epoch + len);
+    offset[2] = len;
+    len += nav_hpposllh(epoch + len);
+    offset[3] = len;
+    len += nav_svin(epoch + len);
+    offset[4] = len;
+    len += nav_sat(epoch + len, 32);
+    offset[5] = len;
+
+    ubx_nav_pvt_t pvt;
+    ubx_nav_dop_t dop;
+    ubx_nav_hpposllh_t pos;
+    ubx_nav_svin_t svin;
+    ubx_nav_sat_t sat;
+    uint32_t sum = 0;
+
+    double start = test_cpu_s();
+    for (int e = 0; e < EPOCHS; e++)
+    {
+        for (int i = 0; i < 5; i++)
+        {
+            const uint8_t* msg = epoch + offset[i];
+            size_t msg_len = offset[i + 1] - offset[i];
+            if (!ubx_check_msg(msg, msg_len))
+            {
+                continue;
+            }
+            switch (msg[3])
+            {
+                case UBX_ID_NAV_PVT:
+                    ubx_decode_nav_pvt(msg, msg_len, &pvt);
+                    sum += pvt.num_sv;
+                    break;
+                case UBX_ID_NAV_DOP:
+                    ubx_decode_nav_dop(msg, msg_len, &dop);
+                    sum += dop.hdop;
+                    break;
+                case UBX_ID_NAV_HPPOSLLH:
+                    ubx_decode_nav_hpposllh(msg, msg_len, &pos);
+                    sum += pos.lat_hp;
+                    break;
+                case UBX_ID_NAV_SVIN:
+                    ubx_decode_nav_svin(msg, msg_len, &svin);
+                    sum += svin.obs;
+                    break;
+                case UBX_ID_NAV_SAT:
+                    ubx_decode_nav_sat(msg, msg_len, &sat);
+                    sum += sat.num_used;
+                    break;
+            }
+        }
+    }
+    double ubx_s = test_cpu_s() - start;
+
+    char gga[128], gst[128];
+    size_t gga_len = make_nmea(gga, "$GNGGA,104800.00,2057.60024012,N,10546.10688035,E,4,28,0.62,12.3000,M,-24.1000,M,1.0,0000");
+    size_t gst_len = make_nmea(gst, "$GNGST,104800.00,12,0.014,0.010,42.1,0.014,0.014,0.021");
+    nmea_index_t index;
+    nmea_gga_t nmea_gga;
+    nmea_gst_t nmea_gst;
+
+    start = test_cpu_s();
+    for (int e = 0; e < EPOCHS; e++)
+    {
+        if (nmea_parse(gga, gga_len, &index) && nmea_decode_gga(&index, &nmea_gga))
+        {
+            sum += nmea_gga.num_sv;
+        }
+        if (nmea_parse(gst, gst_len, &index) && nmea_decode_gst(&index, &nmea_gst))
+        {
+            sum += nmea_gst.sigma_lat;
+        }
+    }
+    double nmea_s = test_cpu_s() - start;
+
+    printf("ubx status epoch (PVT, DOP, HPPOSLLH, SVIN, SAT 32 sv, %u B): %.0f epochs/CPU-ms\n", (unsigned)len, EPOCHS / ubx_s / 1e3);
+    printf("nmea status epoch (GGA, GST, %u B): %.0f epochs/CPU-ms (%u)\n", (unsigned)(gga_len + gst_len), EPOCHS / nmea_s / 1e3, sum);
+}
+
+int main(int argc, char* argv[])
+{
+    test_nav();
+    test_rawx();
+    test_find();
+
+    if (TEST_BENCH(argc, argv))
+    {
+        bench_decode();
+    }
+
+    return TEST_RESULT();
+}
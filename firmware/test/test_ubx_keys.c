@@ -0,0 +1,169 @@
+#include <stdlib.h>
+
+#include "test.h"
+#include "ublox.h"
+#include "ubx_keys.h"
+
+static int compare_id(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static const char* TYPES[] = {"", "U1", "U2", "U4", "U8", "I1", "I2", "I4", "R4", "R8"};
+
+static void test_table()
+{
+    // strictly sorted by strcmp, which the binary search relies on
+    for (int key = 1; key < UBX_KEY_COUNT; key++)
+    {
+        if (strcmp(ubx_keys[key - 1].name, ubx_keys[key].name) >= 0)
+        {
+            printf("out of order: %s, %s\n", ubx_keys[key - 1].name, ubx_keys[key].name);
+            CHECK(false);
+        }
+    }
+
+    // every key is found at its own index, ids are unique and the size bits of each id agree with its type
+    int found = 0, sizes = 0;
+    for (int key = 0; key < UBX_KEY_COUNT; key++)
+    {
+        found += ubx_key_find(ubx_keys[key].name) == (ubx_key_t)key;
+
+        // bits 28..30 of an id: 1 a bit, 2..5 one to eight bytes; bits are sent as U1
+        static const int BYTES[] = {0, 1, 2, 4, 8, 1, 2, 4, 4, 8};
+        int size = (ubx_keys[key].id >> 28) & 7;
+        sizes += size == 1 ? ubx_keys[key].type == UBX_VAL_U1 : size >= 2 && size <= 5 && 1 << (size - 2) == BYTES[ubx_keys[key].type];
+    }
+    CHECK(found == UBX_KEY_COUNT);
+    CHECK(sizes == UBX_KEY_COUNT);
+
+    static uint32_t ids[UBX_KEY_COUNT];
+    for (int key = 0; key < UBX_KEY_COUNT; key++)
+    {
+        ids[key] = ubx_keys[key].id;
+    }
+    qsort(ids, UBX_KEY_COUNT, sizeof(ids[0]), compare_id);
+    int unique = 1;
+    for (int key = 1; key < UBX_KEY_COUNT; key++)
+    {
+        unique += ids[key] != ids[key - 1];
+    }
+    CHECK(unique == UBX_KEY_COUNT);
+
+    // ids the firmware depends on, from the ZED-F9P interface description
+    CHECK(ubx_keys[UBX_KEY_RATE_MEAS].id == 0x30210001 && ubx_keys[UBX_KEY_RATE_MEAS].type == UBX_VAL_U2);
+    CHECK(ubx_keys[UBX_KEY_UART1_BAUDRATE].id == 0x40520001 && ubx_keys[UBX_KEY_UART1_BAUDRATE].type == UBX_VAL_U4);
+    CHECK(ubx_keys[UBX_KEY_MSGOUT_UBX_RXM_RAWX_UART1].id == 0x209102a5);
+    CHECK(ubx_keys[UBX_KEY_TMODE_MODE].id == 0x20030001 && ubx_keys[UBX_KEY_TMODE_LAT].id == 0x40030009);
+    CHECK(ubx_keys[UBX_KEY_TMODE_HEIGHT_HP].id == 0x2003000e && ubx_keys[UBX_KEY_TMODE_HEIGHT_HP].type == UBX_VAL_I1);
+    CHECK(ubx_keys[UBX_KEY_MSGOUT_RTCM_3X_TYPE1005_UART2].id == 0x209102bf);
+    CHECK(ubx_keys[UBX_KEY_MSGOUT_RTCM_3X_TYPE1077_UART2].id == 0x209102ce);
+
+    // names are without the CFG- prefix and case sensitive
+    CHECK(ubx_key_find("RATE-MEAS") == UBX_KEY_RATE_MEAS);
+    CHECK(ubx_key_find("CFG-RATE-MEAS") == UBX_KEY_COUNT);
+    CHECK(ubx_key_find("rate-meas") == UBX_KEY_COUNT);
+    CHECK(ubx_key_find("RATE-MEA") == UBX_KEY_COUNT);
+    CHECK(ubx_key_find("RATE-MEASX") == UBX_KEY_COUNT);
+    CHECK(ubx_key_find("") == UBX_KEY_COUNT);
+    CHECK(ubx_key_find("ZZZ") == UBX_KEY_COUNT && ubx_key_find("AAA") == UBX_KEY_COUNT);
+}
+
+// the generated table holds exactly the rows of scripts/ubx_keys.csv
+static void test_csv()
+{
+    FILE* csv = fopen(UBX_KEYS_CSV, "r");
+    CHECK(csv != NULL);
+    if (csv == NULL)
+    {
+        return;
+    }
+
+    char line[128], name[64], type[8];
+    unsigned int id;
+    int rows = 0, matches = 0;
+    while (fgets(line, sizeof(line), csv) != NULL)
+    {
+        if (line[0] == '#' || line[0] == '\n')
+        {
+            continue;
+        }
+        rows++;
+        if (sscanf(line, "%63[^,],%x,%7[^,\r\n]", name, &id, type) != 3)
+        {
+            printf("bad row: %s", line);
+            continue;
+        }
+
+        ubx_key_t key = ubx_key_find(name);
+        if (key == UBX_KEY_COUNT || ubx_keys[key].id != id || strcmp(TYPES[ubx_keys[key].type], type) != 0)
+        {
+            printf("mismatch: %s", line);
+            continue;
+        }
+        matches++;
+    }
+    fclose(csv);
+
+    CHECK(rows == UBX_KEY_COUNT);
+    CHECK(matches == rows);
+}
+
+static ubx_key_t find_linear(const char* name)
+{
+    for (int key = 0; key < UBX_KEY_COUNT; key++)
+    {
+        if (strcmp(name, ubx_keys[key].name) == 0)
+        {
+            return key;
+        }
+    }
+    return UBX_KEY_COUNT;
+}
+
+// every key once per round, the binary search against the linear scan it replaced
+static void bench_find()
+{
+    const int ROUNDS = 2000;
+    uint32_t hits = 0;
+
+    double start = test_cpu_s();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        for (int key = 0; key < UBX_KEY_COUNT; key++)
+        {
+            hits += ubx_key_find(ubx_keys[key].name) == (ubx_key_t)key;
+        }
+    }
+    double binary = test_cpu_s() - start;
+
+    start = test_cpu_s();
+    for (int round = 0; round < ROUNDS / 20; round++)
+    {
+        for (int key = 0; key < UBX_KEY_COUNT; key++)
+        {
+            hits += find_linear(ubx_keys[key].name) == (ubx_key_t)key;
+        }
+    }
+    double linear = test_cpu_s() - start;
+
+    CHECK(hits == (ROUNDS + ROUNDS / 20) * UBX_KEY_COUNT);
+    printf("ubx_key_find: %d keys, binary %.0f lookups/s, linear %.0f lookups/s\n",
+           UBX_KEY_COUNT,
+           ROUNDS * UBX_KEY_COUNT / binary,
+           ROUNDS / 20 * UBX_KEY_COUNT / linear);
+}
+
+int main(int argc, char* argv[])
+{
+    test_table();
+    test_csv();
+
+    if (TEST_BENCH(argc, argv))
+    {
+        bench_find();
+    }
+
+    return TEST_RESULT();
+}
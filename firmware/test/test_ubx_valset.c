@@ -0,0 +1,262 @@
+#include <stdlib.h>
+
+#include "test.h"
+#include "ublox.h"
+#include "ubx_keys.h"
+
+// "b5 62 ..." to bytes, returns the count
+static size_t hex(const char* text, uint8_t* out)
+{
+    size_t n = 0;
+    unsigned int byte;
+    int used;
+    while (sscanf(text, " %2x%n", &byte, &used) == 1)
+    {
+        out[n++] = byte;
+        text += used;
+    }
+    return n;
+}
+
+static bool equal(const uint8_t* msg, size_t len, const char* expected)
+{
+    uint8_t bytes[UBX_VALSET_LEN_MAX];
+    size_t n = hex(expected, bytes);
+    return len == n && memcmp(msg, bytes, n) == 0;
+}
+
+// the messages u-center generates, kept in the comment at the end of ublox.c
+static const struct
+{
+    const char* text;
+    ubx_key_t key;
+    int32_t val;
+    const char* expected;
+} UCENTER[] = {
+    {"CFG-VALSET 0 1 0 0 CFG-TMODE-MODE 0", UBX_KEY_TMODE_MODE, 0, "b5 62 06 8a 09 00 00 01 00 00 01 00 03 20 00 be 7f"},
+    {"CFG-VALSET 0 1 0 0 CFG-TMODE-MODE 2", UBX_KEY_TMODE_MODE, 2, "b5 62 06 8a 09 00 00 01 00 00 01 00 03 20 02 c0 81"},
+    {"CFG-VALSET 0 1 0 0 CFG-TMODE-POS_TYPE 1", UBX_KEY_TMODE_POS_TYPE, 1, "b5 62 06 8a 09 00 00 01 00 00 02 00 03 20 01 c0 85"},
+    {"CFG-VALSET 0 1 0 0 CFG-TMODE-LAT 209600040", UBX_KEY_TMODE_LAT, 209600040, "b5 62 06 8a 0c 00 00 01 00 00 09 00 03 40 28 3e 7e 0c d9 25"},
+    {"CFG-VALSET 0 1 0 0 CFG-TMODE-LON 1057684480", UBX_KEY_TMODE_LON, 1057684480, "b5 62 06 8a 0c 00 00 01 00 00 0a 00 03 40 00 fc 0a 3f 2f 12"},
+    {"CFG-VALSET 0 1 0 0 CFG-TMODE-HEIGHT -100", UBX_KEY_TMODE_HEIGHT, -100, "b5 62 06 8a 0c 00 00 01 00 00 0b 00 03 40 9c ff ff ff 84 3d"},
+};
+
+static void test_ucenter()
+{
+    uint8_t text[UBX_VALSET_LEN_MAX];
+    uint8_t built[UBX_VALSET_LEN(1)];
+    ubx_valset_t valset;
+
+    for (size_t i = 0; i < sizeof(UCENTER) / sizeof(UCENTER[0]); i++)
+    {
+        uint32_t n = ubx_gen_cmd(UCENTER[i].text, text);
+        CHECK(equal(text, n, UCENTER[i].expected));
+
+        ubx_valset_begin(&valset, built, sizeof(built), UBX_LAYER_RAM);
+        if (ubx_keys[UCENTER[i].key].type == UBX_VAL_U1)
+        {
+            CHECK(ubx_valset_add_u1(&valset, UCENTER[i].key, UCENTER[i].val));
+        }
+        else
+        {
+            CHECK(ubx_valset_add_i4(&valset, UCENTER[i].key, UCENTER[i].val));
+        }
+        n = ubx_valset_end(&valset);
+        CHECK(equal(built, n, UCENTER[i].expected));
+        CHECK(ubx_check_msg(built, n));
+    }
+}
+
+// the fixed base of ubx_set_mode_fixed, every value type the firmware uses, through both paths
+static void test_text_path()
+{
+    static const char TEXT[] =
+        "CFG-VALSET 0 1 0 0 CFG-TMODE-POS_TYPE 1 CFG-TMODE-LAT 209600040 CFG-TMODE-LAT_HP -12 CFG-TMODE-LON 1057684480 "
+        "CFG-TMODE-LON_HP 34 CFG-TMODE-HEIGHT -100 CFG-TMODE-HEIGHT_HP -5 CFG-TMODE-FIXED_POS_ACC 500 CFG-TMODE-MODE 2 "
+        "CFG-UART2OUTPROT-RTCM3X 1 CFG-RATE-MEAS 200 CFG-UART2-BAUDRATE 921600";
+    uint8_t text[UBX_VALSET_LEN_MAX];
+    uint8_t built[UBX_VALSET_LEN(12)];
+    ubx_valset_t valset;
+
+    ubx_valset_begin(&valset, built, sizeof(built), UBX_LAYER_RAM);
+    ubx_valset_add_u1(&valset, UBX_KEY_TMODE_POS_TYPE, 1);
+    ubx_valset_add_i4(&valset, UBX_KEY_TMODE_LAT, 209600040);
+    ubx_valset_add_i1(&valset, UBX_KEY_TMODE_LAT_HP, -12);
+    ubx_valset_add_i4(&valset, UBX_KEY_TMODE_LON, 1057684480);
+    ubx_valset_add_i1(&valset, UBX_KEY_TMODE_LON_HP, 34);
+    ubx_valset_add_i4(&valset, UBX_KEY_TMODE_HEIGHT, -100);
+    ubx_valset_add_i1(&valset, UBX_KEY_TMODE_HEIGHT_HP, -5);
+    ubx_valset_add_u4(&valset, UBX_KEY_TMODE_FIXED_POS_ACC, 500);
+    ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 2);
+    ubx_valset_add_u1(&valset, UBX_KEY_UART2OUTPROT_RTCM3X, 1);
+    ubx_valset_add_u2(&valset, UBX_KEY_RATE_MEAS, 200);
+    ubx_valset_add_u4(&valset, UBX_KEY_UART2_BAUDRATE, 921600);
+    uint32_t n = ubx_valset_end(&valset);
+
+    CHECK(n == UBX_HEADER_LEN + 4 + 12 * 4 + 6 * 1 + 5 * 4 + 2 + UBX_CHECKSUM_LEN);
+    CHECK(n == ubx_gen_cmd(TEXT, text) && memcmp(built, text, n) == 0);
+    CHECK(ubx_check_msg(built, n));
+
+    // the checksum over the whole message, as a receiver computes it
+    uint8_t ck_a = 0, ck_b = 0;
+    for (uint32_t i = 2; i < n - UBX_CHECKSUM_LEN; i++)
+    {
+        ck_a += built[i];
+        ck_b += ck_a;
+    }
+    CHECK(built[n - 2] == ck_a && built[n - 1] == ck_b);
+
+    // version 1 with a transaction, the other layers
+    ubx_valset_begin(&valset, built, sizeof(built), UBX_LAYER_BBR | UBX_LAYER_FLASH);
+    ubx_valset_transaction(&valset, 1);
+    ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 0);
+    n = ubx_valset_end(&valset);
+    CHECK(n == ubx_gen_cmd("CFG-VALSET 1 6 1 0 CFG-TMODE-MODE 0", text) && memcmp(built, text, n) == 0);
+    CHECK(built[6] == 1 && built[7] == 6 && built[8] == 1 && ubx_check_msg(built, n));
+}
+
+static void test_errors()
+{
+    uint8_t buff[UBX_VALSET_LEN_MAX + 16];
+    ubx_valset_t valset;
+
+    // a value of the wrong type fails the whole message
+    ubx_valset_begin(&valset, buff, sizeof(buff), UBX_LAYER_RAM);
+    CHECK(ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 1));
+    CHECK(!ubx_valset_add_u2(&valset, UBX_KEY_TMODE_MODE, 1));
+    CHECK(!ubx_valset_add_u1(&valset, UBX_KEY_RATE_MEAS, 1));
+    CHECK(ubx_valset_end(&valset) == 0);
+
+    // no key, or one that does not exist
+    ubx_valset_begin(&valset, buff, sizeof(buff), UBX_LAYER_RAM);
+    CHECK(ubx_valset_end(&valset) == 0);
+    CHECK(!ubx_valset_add_u1(&valset, UBX_KEY_COUNT, 1) && ubx_valset_end(&valset) == 0);
+
+    // exactly the space for two U4 values, not for a third
+    ubx_valset_begin(&valset, buff, UBX_HEADER_LEN + 4 + 2 * 8 + UBX_CHECKSUM_LEN, UBX_LAYER_RAM);
+    CHECK(ubx_valset_add_u4(&valset, UBX_KEY_UART1_BAUDRATE, 38400));
+    CHECK(ubx_valset_add_u4(&valset, UBX_KEY_UART2_BAUDRATE, 921600));
+    CHECK(!ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 0));
+    CHECK(ubx_valset_end(&valset) == 0);
+    ubx_valset_begin(&valset, buff, UBX_VALSET_LEN(0) - 1, UBX_LAYER_RAM);
+    CHECK(!ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 0));
+
+    // at most UBX_VALSET_KEYS_MAX pairs, whatever the space
+    ubx_valset_begin(&valset, buff, sizeof(buff), UBX_LAYER_RAM);
+    for (int i = 0; i < UBX_VALSET_KEYS_MAX; i++)
+    {
+        CHECK(ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 0));
+    }
+    CHECK(!ubx_valset_add_u1(&valset, UBX_KEY_TMODE_MODE, 0));
+
+    // the text path: unknown key, missing prefix
+    CHECK(ubx_gen_cmd("CFG-VALSET 0 1 0 0 CFG-TMODE-MODEX 0", buff) == 0);
+    CHECK(ubx_gen_cmd("CFG-VALSET 0 1 0 0 TMODE-MODE 0", buff) == 0);
+}
+
+static void test_valget()
+{
+    uint8_t poll[16];
+    uint8_t answer[64];
+    uint64_t val;
+
+    CHECK(ubx_gen_valget(UBX_KEY_TMODE_MODE, 0, poll) == 16);
+    CHECK(ubx_check_msg(poll, 16) && equal(poll, 14, "b5 62 06 8b 08 00 00 00 00 00 01 00 03 20"));
+
+    // a version 1 answer with a bit, an 8 byte and a 1 byte value
+    const char* ANSWER = "b5 62 06 8b 1a 00 01 00 00 00 "
+                         "01 00 65 10 01 "                       // USB-ENABLED, a bit
+                         "11 00 65 50 01 02 03 04 05 06 07 08 "  // USB-PRODUCT_STR0
+                         "01 00 03 20 02 "                       // TMODE-MODE
+                         "00 00";
+    size_t len = hex(ANSWER, answer);
+    uint8_t ck_a = 0, ck_b = 0;
+    for (size_t i = 2; i < len - UBX_CHECKSUM_LEN; i++)
+    {
+        ck_a += answer[i];
+        ck_b += ck_a;
+    }
+    answer[len - 2] = ck_a;
+    answer[len - 1] = ck_b;
+
+    CHECK(ubx_decode_cfg_valget(answer, len, UBX_KEY_TMODE_MODE, &val) && val == 2);
+    CHECK(ubx_decode_cfg_valget(answer, len, UBX_KEY_USB_PRODUCT_STR0, &val) && val == 0x0807060504030201ULL);
+    CHECK(ubx_decode_cfg_valget(answer, len, UBX_KEY_USB_ENABLED, &val) && val == 1);
+    CHECK(!ubx_decode_cfg_valget(answer, len, UBX_KEY_RATE_MEAS, &val));
+}
+
+// the default configuration of ubx_send_default, built directly and parsed from text
+static void bench_valset()
+{
+    static const char TEXT[] =
+        "CFG-VALSET 0 1 0 0 CFG-MSGOUT-NMEA_ID_GGA_UART1 0 CFG-MSGOUT-NMEA_ID_GST_UART1 0 CFG-MSGOUT-NMEA_ID_GLL_UART1 0 "
+        "CFG-MSGOUT-NMEA_ID_GSA_UART1 0 CFG-MSGOUT-NMEA_ID_GSV_UART1 0 CFG-MSGOUT-NMEA_ID_RMC_UART1 0 CFG-MSGOUT-NMEA_ID_VTG_UART1 0 "
+        "CFG-INFMSG-NMEA_UART1 0 CFG-NMEA-HIGHPREC 1 CFG-MSGOUT-UBX_RXM_RAWX_UART1 0 CFG-MSGOUT-UBX_RXM_SFRBX_UART1 0 "
+        "CFG-UART1INPROT-RTCM3X 0 CFG-UART1OUTPROT-RTCM3X 0 CFG-UART2-BAUDRATE 115200 CFG-UART2OUTPROT-NMEA 0 "
+        "CFG-UART2OUTPROT-UBX 0 CFG-UART2OUTPROT-RTCM3X 0";
+    static const ubx_key_t KEYS[] = {
+        UBX_KEY_MSGOUT_NMEA_ID_GGA_UART1, UBX_KEY_MSGOUT_NMEA_ID_GST_UART1, UBX_KEY_MSGOUT_NMEA_ID_GLL_UART1, UBX_KEY_MSGOUT_NMEA_ID_GSA_UART1,
+        UBX_KEY_MSGOUT_NMEA_ID_GSV_UART1, UBX_KEY_MSGOUT_NMEA_ID_RMC_UART1, UBX_KEY_MSGOUT_NMEA_ID_VTG_UART1, UBX_KEY_INFMSG_NMEA_UART1,
+        UBX_KEY_NMEA_HIGHPREC,            UBX_KEY_MSGOUT_UBX_RXM_RAWX_UART1, UBX_KEY_MSGOUT_UBX_RXM_SFRBX_UART1, UBX_KEY_UART1INPROT_RTCM3X,
+        UBX_KEY_UART1OUTPROT_RTCM3X,      UBX_KEY_UART2_BAUDRATE,           UBX_KEY_UART2OUTPROT_NMEA,         UBX_KEY_UART2OUTPROT_UBX,
+        UBX_KEY_UART2OUTPROT_RTCM3X,
+    };
+    const int KEY_COUNT = sizeof(KEYS) / sizeof(KEYS[0]);
+    const int ROUNDS = 200000;
+    uint8_t built[UBX_VALSET_LEN(17)];
+    uint8_t text[UBX_VALSET_LEN_MAX];
+    ubx_valset_t valset;
+    uint64_t bytes = 0;
+    uint32_t n = 0;
+
+    double start = test_cpu_s();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        ubx_valset_begin(&valset, built, sizeof(built), UBX_LAYER_RAM);
+        for (int i = 0; i < KEY_COUNT; i++)
+        {
+            if (KEYS[i] == UBX_KEY_UART2_BAUDRATE)
+            {
+                ubx_valset_add_u4(&valset, KEYS[i], 115200);
+            }
+            else
+            {
+                ubx_valset_add_u1(&valset, KEYS[i], KEYS[i] == UBX_KEY_NMEA_HIGHPREC);
+            }
+        }
+        n = ubx_valset_end(&valset);
+        bytes += n;
+    }
+    double builder = test_cpu_s() - start;
+
+    start = test_cpu_s();
+    for (int round = 0; round < ROUNDS / 10; round++)
+    {
+        bytes += ubx_gen_cmd(TEXT, text);
+    }
+    double parsed = test_cpu_s() - start;
+
+    CHECK(n > 0 && bytes == (uint64_t)(ROUNDS + ROUNDS / 10) * n && memcmp(built, text, n) == 0);
+    printf("ubx valset of %d keys (%u bytes): builder %.2f us, %.0f MB/s; text %.2f us, %.1f MB/s\n",
+           KEY_COUNT,
+           n,
+           builder / ROUNDS * 1e6,
+           (double)ROUNDS * n / builder / 1e6,
+           parsed / (ROUNDS / 10) * 1e6,
+           (double)(ROUNDS / 10) * n / parsed / 1e6);
+}
+
+int main(int argc, char* argv[])
+{
+    test_ucenter();
+    test_text_path();
+    test_errors();
+    test_valget();
+
+    if (TEST_BENCH(argc, argv))
+    {
+        bench_valset();
+    }
+
+    return TEST_RESULT();
+}